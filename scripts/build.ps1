@@ -5,6 +5,7 @@ param(
     [switch]$Clean,
     [switch]$Verbose,
     [switch]$Wasm,
+    [switch]$DebugHeap,
     [switch]$Help
 )
 
@@ -37,6 +38,7 @@ if ($Help) {
     Write-Host "  -Clean     Clean the build directory before building"
     Write-Host "  -Verbose   Show verbose build output"
     Write-Host "  -Wasm      Build for WebAssembly using Emscripten"
+    Write-Host "  -DebugHeap Guard heap blocks with canaries and quarantine freed memory"
     Write-Host "  -Help      Show this help message"
     exit 0
 }
@@ -101,6 +103,8 @@ if (-not (Test-Path -Path $BuildDir)) {
 New-Item -ItemType Directory -Path "$BinDir\assets" -Force | Out-Null
 New-Item -ItemType Directory -Path "$BinDir\shaders" -Force | Out-Null
 
+$DebugHeapArg = if ($DebugHeap) { "-DPIXELPULSE_DEBUG_HEAP=ON" } else { "-DPIXELPULSE_DEBUG_HEAP=OFF" }
+
 # Configure and build
 Write-Host "Configuring build for $Platform-$Arch..."
 
@@ -118,6 +122,7 @@ if ($Wasm) {
         "cmake",
         "-B", $BuildDir,
         "-DCMAKE_BUILD_TYPE=$BuildType",
+        $DebugHeapArg,
         "-DCMAKE_CXX_FLAGS=-O3",
         "-DCMAKE_EXE_LINKER_FLAGS=-s MODULARIZE=1 -s EXPORT_NAME='createPixelPulseModule' -s 'EXPORTED_FUNCTIONS=[`"_main`"]'",
         "-DCMAKE_INSTALL_PREFIX=$BinDir"
@@ -135,7 +140,7 @@ if ($Wasm) {
     & cmake $BuildArgs
 } else {
     # Native build
-    $CmakeArgs = @("-S", ".", "-B", "build", "-DCMAKE_BUILD_TYPE=$BuildType")
+    $CmakeArgs = @("-S", ".", "-B", "build", "-DCMAKE_BUILD_TYPE=$BuildType", $DebugHeapArg)
     if ($Verbose) {
         $CmakeArgs += "-DCMAKE_VERBOSE_MAKEFILE=ON"
     }
@@ -25,6 +25,7 @@ BUILD_TYPE="Release"
 CLEAN=false
 VERBOSE=false
 USE_WASM=false
+DEBUG_HEAP=false
 
 for arg in "$@"; do
     case $arg in
@@ -44,6 +45,10 @@ for arg in "$@"; do
         USE_WASM=true
         shift
         ;;
+        --debug-heap)
+        DEBUG_HEAP=true
+        shift
+        ;;
         --help)
         echo "Usage: build.sh [options]"
         echo "Options:"
@@ -51,6 +56,7 @@ for arg in "$@"; do
         echo "  --clean    Clean the build directory before building"
         echo "  --verbose  Show verbose build output"
         echo "  --wasm     Build for WebAssembly using Emscripten"
+        echo "  --debug-heap  Guard heap blocks with canaries and quarantine freed memory"
         echo "  --help     Show this help message"
         exit 0
         ;;
@@ -106,6 +112,11 @@ echo "Configuring build for $PLATFORM-$ARCH..."
 
 BINARY_NAME="pixel_pulse"
 
+DEBUG_HEAP_ARG="-DPIXELPULSE_DEBUG_HEAP=OFF"
+if [ "$DEBUG_HEAP" == "true" ]; then
+    DEBUG_HEAP_ARG="-DPIXELPULSE_DEBUG_HEAP=ON"
+fi
+
 if [ "$BUILD_TYPE" == "Debug" ]; then
     BINARY_NAME="$BINARY_NAME-Debug"
 fi
@@ -121,6 +132,7 @@ if [ "$USE_WASM" == "true" ]; then
     echo "Configuring CMake for Emscripten..."
     emcmake cmake -B build/$PLATFORM-$ARCH \
                   -DCMAKE_BUILD_TYPE=$BUILD_TYPE \
+                  $DEBUG_HEAP_ARG \
                   -DCMAKE_INSTALL_PREFIX=bin/$PLATFORM-$ARCH \
                   -DCMAKE_EXECUTABLE_SUFFIX=".html"
 
@@ -137,7 +149,7 @@ if [ "$USE_WASM" == "true" ]; then
     cmake $BUILD_ARGS
 else
     # Native build
-    CMAKE_ARGS="-S . -B build -DCMAKE_BUILD_TYPE=$BUILD_TYPE"
+    CMAKE_ARGS="-S . -B build -DCMAKE_BUILD_TYPE=$BUILD_TYPE $DEBUG_HEAP_ARG"
     if [ "$VERBOSE" == "true" ]; then
         CMAKE_ARGS="$CMAKE_ARGS -DCMAKE_VERBOSE_MAKEFILE=ON"
     fi
@@ -1,5 +1,6 @@
 #include "AssetRegistry.h"
 #include "IAsset.h"
+#include "Atlas.h"
 
 namespace PixelPulse::Assets
 {
@@ -135,6 +136,38 @@ namespace PixelPulse::Assets
         Logger::info("Asset unloading complete. Unloaded: %d", unloadedCount);
     }
 
+    void AssetRegistry::addAtlas(Atlas *atlas)
+    {
+        if (std::find(m_atlases.begin(), m_atlases.end(), atlas) == m_atlases.end())
+        {
+            m_atlases.push_back(atlas);
+        }
+    }
+
+    void AssetRegistry::removeAtlas(Atlas *atlas)
+    {
+        auto it = std::find(m_atlases.begin(), m_atlases.end(), atlas);
+        if (it != m_atlases.end())
+        {
+            m_atlases.erase(it);
+        }
+    }
+
+    const AtlasEntry *AssetRegistry::findAtlasEntry(const char *path, const Atlas **atlas) const
+    {
+        for (const Atlas *candidate : m_atlases)
+        {
+            const AtlasEntry *entry = candidate->findEntry(path);
+            if (entry)
+            {
+                *atlas = candidate;
+                return entry;
+            }
+        }
+
+        return nullptr;
+    }
+
     IAsset *AssetRegistry::findAsset(const char *path)
     {
         for (auto asset : m_assets)
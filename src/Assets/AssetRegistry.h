@@ -4,11 +4,15 @@
 #define PIXELPULSE_ASSET_REGISTRY_H
 
 #include "../Platform/Std.h"
+#include "../Platform/Containers.h"
 #include "IAsset.h"
 #include "../Logger.h"
 
 namespace PixelPulse::Assets
 {
+    class Atlas;
+    struct AtlasEntry;
+
     struct AssetMakeRequest
     {
         const char *path;
@@ -17,8 +21,9 @@ namespace PixelPulse::Assets
     class AssetRegistry
     {
     private:
-        std::vector<IAsset *> m_assets;
-        std::vector<IAsset *> m_assetsUnloadQueue;
+        Platform::Vector<IAsset *, Platform::Memory::MemoryTag::Assets> m_assets;
+        Platform::Vector<IAsset *, Platform::Memory::MemoryTag::Assets> m_assetsUnloadQueue;
+        Platform::Vector<Atlas *, Platform::Memory::MemoryTag::Assets> m_atlases; // Loaded ones only
 
         AssetRegistry(const AssetRegistry &) = delete;
         AssetRegistry &operator=(const AssetRegistry &) = delete;
@@ -40,6 +45,13 @@ namespace PixelPulse::Assets
 
         void flushActiveQueue();
 
+        // Called by Atlas on load and unload, images found in a loaded atlas skip decoding
+        void addAtlas(Atlas *atlas);
+        void removeAtlas(Atlas *atlas);
+
+        // The first loaded atlas holding the image path, or null
+        const AtlasEntry *findAtlasEntry(const char *path, const Atlas **atlas) const;
+
         template <typename T>
         T *make(AssetMakeRequest request)
         {
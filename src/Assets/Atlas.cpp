@@ -0,0 +1,188 @@
+#include "Atlas.h"
+#include "AssetRegistry.h"
+#include "../Libraries/JSON.h"
+#include "../Logger.h"
+
+using json = nlohmann::json;
+
+namespace PixelPulse::Assets
+{
+    Atlas::Atlas() : m_loaded(false)
+    {
+    }
+
+    Atlas::~Atlas()
+    {
+        if (m_loaded)
+        {
+            unload();
+        }
+    }
+
+    bool Atlas::load()
+    {
+        if (m_loaded)
+        {
+            Logger::warning("Atlas is already loaded: %s", getPath());
+            return true;
+        }
+
+        const char *pathAbsolute = getPathAbsolute();
+        std::ifstream file(pathAbsolute);
+        if (!file.is_open())
+        {
+            Logger::warning("Atlas: No manifest at %s", pathAbsolute);
+            return false;
+        }
+
+        // Page files are relative to the manifest
+        std::string directory(pathAbsolute);
+        std::size_t separator = directory.find_last_of("/\\");
+        directory.resize(separator == std::string::npos ? 0 : separator + 1);
+
+        try
+        {
+            json manifest = json::parse(file);
+
+            for (const auto &pageJson : manifest.at("pages"))
+            {
+                std::string pagePath = directory + pageJson.at("file").get<std::string>();
+
+                AtlasPage page{0, 0, nullptr};
+                if (!loadPage(pagePath.c_str(), page))
+                {
+                    unload();
+                    return false;
+                }
+                m_pages.push_back(page);
+            }
+
+            const json &images = manifest.at("images");
+            m_entries.reserve(images.size());
+
+            for (const auto &imageJson : images)
+            {
+                AtlasEntry entry;
+                entry.page = imageJson.at("page").get<std::uint32_t>();
+                entry.x = imageJson.at("x").get<std::int32_t>();
+                entry.y = imageJson.at("y").get<std::int32_t>();
+                entry.width = imageJson.at("width").get<std::int32_t>();
+                entry.height = imageJson.at("height").get<std::int32_t>();
+
+                const std::string &imagePath = imageJson.at("path").get_ref<const std::string &>();
+
+                if (entry.page >= m_pages.size() ||
+                    entry.x < 0 || entry.y < 0 || entry.width <= 0 || entry.height <= 0 ||
+                    entry.x + entry.width > m_pages[entry.page].width ||
+                    entry.y + entry.height > m_pages[entry.page].height)
+                {
+                    Logger::error("Atlas: Entry '%s' is outside its page in %s", imagePath.c_str(), pathAbsolute);
+                    unload();
+                    return false;
+                }
+
+                m_paths.insert(m_paths.end(), imagePath.begin(), imagePath.end());
+                m_paths.push_back('\0');
+                m_entries.push_back(entry);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            Logger::error("Atlas: Invalid manifest %s: %s", pathAbsolute, e.what());
+            unload();
+            return false;
+        }
+
+        // Keyed once m_paths is complete, it does not move afterwards
+        m_entryIndices.reserve(m_entries.size());
+        const char *path = m_paths.data();
+        for (std::uint32_t i = 0; i < m_entries.size(); ++i)
+        {
+            std::string_view key(path);
+            m_entryIndices.emplace(key, i);
+            path += key.size() + 1;
+        }
+
+        m_loaded = true;
+        if (m_registry)
+        {
+            m_registry->addAtlas(this);
+        }
+
+        Logger::info("Loaded atlas: %s (%zu pages, %zu images)", pathAbsolute, m_pages.size(), m_entries.size());
+        return true;
+    }
+
+    bool Atlas::loadPage(const char *path, AtlasPage &page)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            Logger::error("Atlas: Failed to open page %s", path);
+            return false;
+        }
+
+        AtlasPageHeader header;
+        if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+            header.magic != PageMagic || header.version != PageVersion ||
+            header.width == 0 || header.height == 0 || header.width > 16384 || header.height > 16384)
+        {
+            Logger::error("Atlas: Invalid page header in %s", path);
+            return false;
+        }
+
+        std::size_t size = static_cast<std::size_t>(header.width) * header.height * 4;
+        unsigned char *pixels = static_cast<unsigned char *>(PP_MALLOC(size));
+        if (!pixels)
+        {
+            Logger::error("Atlas: Failed to allocate %zu bytes for page %s", size, path);
+            return false;
+        }
+
+        if (!file.read(reinterpret_cast<char *>(pixels), static_cast<std::streamsize>(size)))
+        {
+            Logger::error("Atlas: Page %s is truncated", path);
+            PP_FREE(pixels);
+            return false;
+        }
+
+        page.width = static_cast<std::int32_t>(header.width);
+        page.height = static_cast<std::int32_t>(header.height);
+        page.pixels = pixels;
+        return true;
+    }
+
+    void Atlas::unload()
+    {
+        if (m_loaded && m_registry)
+        {
+            m_registry->removeAtlas(this);
+        }
+
+        for (AtlasPage &page : m_pages)
+        {
+            PP_FREE(page.pixels);
+        }
+        m_pages.clear();
+        m_entryIndices.clear();
+        m_entries.clear();
+        m_paths.clear();
+        m_loaded = false;
+    }
+
+    bool Atlas::isLoaded() const
+    {
+        return m_loaded;
+    }
+
+    const AtlasEntry *Atlas::findEntry(const char *path) const
+    {
+        if (!path)
+        {
+            return nullptr;
+        }
+
+        auto it = m_entryIndices.find(std::string_view(path));
+        return it != m_entryIndices.end() ? &m_entries[it->second] : nullptr;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef PIXELPULSE_ATLAS_H
+#define PIXELPULSE_ATLAS_H
+
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "IAsset.h"
+
+namespace PixelPulse::Assets
+{
+    // Header of a baked page file, followed by width * height RGBA8 pixels, row by row
+    struct AtlasPageHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    // Where a source image lives in the baked pages, in pixels
+    struct AtlasEntry
+    {
+        std::uint32_t page;
+        std::int32_t x;
+        std::int32_t y;
+        std::int32_t width;
+        std::int32_t height;
+    };
+
+    // A baked page, width * height RGBA8 pixels, row by row
+    struct AtlasPage
+    {
+        std::int32_t width;
+        std::int32_t height;
+        unsigned char *pixels;
+    };
+
+    // Pages baked offline by pixel_pulse_atlas (see tools/atlas), loaded from a JSON manifest
+    // that lists the page files and the sub-rectangle of every source image. Pages are stored
+    // pre-decoded, so loading is a plain read. Once loaded, the atlas is known to its registry
+    // and images it contains skip decoding: the TextureCache uploads their page whole and
+    // points their region into it. The atlas must stay loaded while such images are acquired.
+    class Atlas : public IAsset
+    {
+    public:
+        static constexpr std::uint32_t PageMagic = 0x58545050; // "PPTX"
+        static constexpr std::uint32_t PageVersion = 1;
+
+        Atlas();
+        virtual ~Atlas();
+
+        const char *getName() const override { return "Atlas"; }
+        bool load() override;
+        void unload() override;
+        bool isLoaded() const override;
+
+        // Null if the image path (as given to AssetRegistry::make) was not baked into the atlas
+        const AtlasEntry *findEntry(const char *path) const;
+
+        const AtlasPage &getPage(std::uint32_t index) const { return m_pages[index]; }
+        std::size_t getPageCount() const { return m_pages.size(); }
+        std::size_t getEntryCount() const { return m_entries.size(); }
+
+    private:
+        bool loadPage(const char *path, AtlasPage &page);
+
+        Platform::Vector<AtlasPage, Platform::Memory::MemoryTag::Assets> m_pages;
+        Platform::Vector<AtlasEntry, Platform::Memory::MemoryTag::Assets> m_entries;
+        Platform::Vector<char, Platform::Memory::MemoryTag::Assets> m_paths; // Entry paths, null-terminated, back to back
+        Platform::UnorderedMap<std::string_view, std::uint32_t, Platform::Memory::MemoryTag::Assets> m_entryIndices; // Keys point into m_paths
+        bool m_loaded;
+    };
+}
+
+#endif
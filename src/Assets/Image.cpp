@@ -1,4 +1,6 @@
 #include "Image.h"
+#include "Atlas.h"
+#include "AssetRegistry.h"
 #include "Logger.h"
 #include "Platform/Platform.h"
 #include "Platform/String.h"
@@ -8,7 +10,8 @@ namespace PixelPulse::Assets
     Image::Image() : width(0),
                      height(0),
                      channels(0),
-                     data(nullptr)
+                     data(nullptr),
+                     m_baked(false)
     {
     }
 
@@ -22,12 +25,24 @@ namespace PixelPulse::Assets
 
     bool Image::load()
     {
-        if (data)
+        if (isLoaded())
         {
             Logger::warning("Image data are already loaded: %s", getPath());
             return true;
         }
 
+        const Atlas *atlas = nullptr;
+        if (const AtlasEntry *entry = m_registry ? m_registry->findAtlasEntry(getPath(), &atlas) : nullptr)
+        {
+            width = entry->width;
+            height = entry->height;
+            channels = 4;
+            m_baked = true;
+
+            Logger::info("Loaded image: %s (%dx%d), baked into atlas %s", getPath(), width, height, atlas->getPath());
+            return true;
+        }
+
         const char *pathAbsolute = getPathAbsolute();
         data = stbi_load(pathAbsolute, &width, &height, &channels, 4);
 
@@ -51,14 +66,20 @@ namespace PixelPulse::Assets
             stbi_image_free(data);
             data = nullptr;
         }
-        else
+        else if (!m_baked)
         {
             Logger::warning("Image already unloaded: %s", getPath());
         }
+        m_baked = false;
+    }
+
+    const AtlasEntry *Image::findAtlasEntry(const Atlas **atlas) const
+    {
+        return (m_baked && m_registry) ? m_registry->findAtlasEntry(getPath(), atlas) : nullptr;
     }
 
     bool Image::isLoaded() const
     {
-        return data != nullptr;
+        return data != nullptr || m_baked;
     }
 }
@@ -9,6 +9,11 @@
 
 namespace PixelPulse::Assets
 {
+    class Atlas;
+    struct AtlasEntry;
+
+    // RGBA8 image, decoded from the file. When a loaded Atlas holds the path the image is baked:
+    // only its size is known and data stays null, the pixels are on the atlas page.
     class Image : public IAsset
     {
     public:
@@ -24,6 +29,14 @@ namespace PixelPulse::Assets
         bool load() override;
         void unload() override;
         bool isLoaded() const override;
+
+        bool isBaked() const { return m_baked; }
+
+        // Where a baked image lives, null if the image is not baked or its atlas is gone
+        const AtlasEntry *findAtlasEntry(const Atlas **atlas) const;
+
+    private:
+        bool m_baked;
     };
 }
 
@@ -2,7 +2,6 @@
 #include "../../Game/SceneNode.h"
 #include "../../Game/Events/UpdateEventPayload.h"
 #include "../../Game/Input.h"
-#include "../../Assets/Image.h"
 #include "../../Game/Sprite.h"
 #include "../../Game/EntityLibrary.h"
 
@@ -14,68 +13,68 @@ namespace PixelPulse::Entities
     PIXELPULSE_REGISTER_ENTITY(EnemyEntity);
 
     EnemyEntity::EnemyEntity()
+        : m_physicsComponent(this)
     {
         m_moveSpeed = 100.0f;
-        m_physicsComponent = PP_NEW(PhysicsComponent, this);
+        m_collider = nullptr;
+        m_prefab = nullptr;
     }
 
     EnemyEntity::~EnemyEntity()
     {
-        if (m_physicsComponent)
-        {
-            PP_DELETE(m_physicsComponent);
-            m_physicsComponent = nullptr;
-        }
     }
 
-    void EnemyEntity::onUpdate(SceneNode *ownerNode, const UpdateEventPayload &payload)
+    void EnemyEntity::definePrefab(PrefabDefinition &definition)
     {
-        PIXELPULSE_ARG_UNUSED(payload);
-
-        Math::Vector2<float> position = m_physicsComponent->getPosition();
-        ownerNode->m_position = position;
+        definition.imagePath = "assets/skeleton.png";
+        definition.colliderSize = Math::Vector2<float>(50.0f, 50.0f);
+        definition.renderLayer = "actors";
     }
 
     void EnemyEntity::onAttach(SceneNode *ownerNode, const AttachEventPayload &payload)
     {
-        Logger::info("EnemyEntity attached to node: %s", ownerNode->getTag());
-        Assets::AssetRegistry *assetRegistry = payload.assetRegistry;
+        ComponentEntity::onAttach(ownerNode, payload);
 
-        m_enemyImage = assetRegistry->make<Assets::Image>(Assets::AssetMakeRequest{"assets/skeleton.png"});
-        m_enemyImage->load();
+        Logger::debug("EnemyEntity attached to node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *skeletonSprite = PP_NEW(Sprite, m_enemyImage);
-        if (!skeletonSprite->init(payload.renderer))
+        m_prefab = payload.prefab;
+        if (!m_prefab || !m_prefab->sprite)
         {
-            Logger::error("Failed to initialize sprite");
+            Logger::error("EnemyEntity: Prefab has no sprite");
             return;
         }
 
-        ownerNode->setSprite(skeletonSprite);
+        ownerNode->setScale(m_prefab->definition.scale);
+
+        // The sprite is shared by every enemy, it belongs to the prefab
+        if (m_components)
+        {
+            m_components->add<SpriteComponent>(m_handle, m_prefab->sprite);
+        }
     }
 
     void EnemyEntity::onStart(SceneNode *ownerNode, const StartEventPayload &payload)
     {
-        if (!m_physicsComponent)
+        ComponentEntity::onStart(ownerNode, payload);
+
+        m_physicsComponent.initialize(payload.physicsWorld, ownerNode->getPosition());
+        if (m_prefab && m_prefab->hasCollider())
         {
-            Logger::error("EnemyEntity::onStart - Physics component is null");
-            return;
+            m_collider = m_physicsComponent.createBoxCollider(m_prefab->definition.colliderSize);
         }
 
-        m_physicsComponent->initialize(payload.physicsWorld, ownerNode->m_position);
-        m_collider = m_physicsComponent->createBoxCollider(Math::Vector2<float>(50.0f, 50.0f));
+        // The physics sync phase moves the component position, and with it the node, with the body
+        if (m_components && m_physicsComponent.getRigidBody())
+        {
+            m_components->add<RigidBodyComponent>(m_handle, m_physicsComponent.getRigidBody());
+        }
     }
 
     void EnemyEntity::onDetach(SceneNode *ownerNode)
     {
-        Logger::info("EnemyEntity detached from node: %s", ownerNode->getTag());
+        Logger::debug("EnemyEntity detached from node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *sprite = ownerNode->getSprite();
-        if (sprite)
-        {
-            PP_DELETE(sprite);
-            ownerNode->setSprite(nullptr);
-        }
+        ComponentEntity::onDetach(ownerNode);
     }
 
     void EnemyEntity::onCollision(PixelPulse::Physics::Collider *collider, const PixelPulse::Physics::CollisionInfo &info)
@@ -83,6 +82,6 @@ namespace PixelPulse::Entities
         PIXELPULSE_ARG_UNUSED(collider);
         PIXELPULSE_ARG_UNUSED(info);
 
-        Logger::info("EnemyEntity collided with another collider");
+        Logger::debug("EnemyEntity collided with another collider");
     }
 }
@@ -4,31 +4,33 @@
 #define PIXELPULSE_ENEMYENTITY_H
 
 #include "../../Platform/Std.h"
-#include "../../Game/IEntity.h"
-#include "../../Assets/Image.h"
+#include "../../Game/ComponentEntity.h"
+#include "../../Game/Prefab.h"
 #include "../../Math/Vector2.h"
 #include "../../Game/PhysicsComponent.h"
 
 namespace PixelPulse::Entities
 {
-    class EnemyEntity : public Game::IEntity
+    // Keeps its sprite and rigid body in the scene's component registry
+    class EnemyEntity : public Game::ComponentEntity
     {
     private:
         float m_moveSpeed;
-        Game::PhysicsComponent* m_physicsComponent;
+        Game::PhysicsComponent m_physicsComponent;
         PixelPulse::Physics::BoxCollider* m_collider;
-        Assets::Image* m_enemyImage;
+        const Game::Prefab* m_prefab;
 
     public:
         EnemyEntity();
         virtual ~EnemyEntity();
 
-        void onUpdate(Game::SceneNode *ownerNode, const Game::Events::UpdateEventPayload &payload) override;
         void onAttach(Game::SceneNode *ownerNode, const Game::Events::AttachEventPayload &payload) override;
         void onStart(Game::SceneNode *ownerNode, const Game::Events::StartEventPayload &payload) override;
         void onDetach(Game::SceneNode *ownerNode) override;
         void onCollision(PixelPulse::Physics::Collider *collider, const PixelPulse::Physics::CollisionInfo &info) override;
 
+        static void definePrefab(Game::PrefabDefinition &definition);
+
         static Game::EntityID getID()
         {
             return "EnemyEntity1";
@@ -17,65 +17,58 @@ namespace PixelPulse::Entities
     PIXELPULSE_REGISTER_ENTITY(FloorEntity);
 
     FloorEntity::FloorEntity()
-        : m_physicsComponent(nullptr), m_collider(nullptr), m_tileCount(10), m_tileWidth(0.0f), m_floorWidth(2000.0f), m_floorHeight(50.0f)
+        : m_physicsComponent(this), m_collider(nullptr), m_tileCount(10), m_tileWidth(0.0f), m_floorWidth(2000.0f), m_floorHeight(50.0f)
     {
-        m_physicsComponent = PP_NEW(PhysicsComponent, this);
     }
 
     FloorEntity::~FloorEntity()
     {
-        if (m_physicsComponent)
-        {
-            PP_DELETE(m_physicsComponent);
-            m_physicsComponent = nullptr;
-        }
     }
 
-    void FloorEntity::onAttach(SceneNode *ownerNode, const AttachEventPayload &payload)
+    void FloorEntity::definePrefab(PrefabDefinition &definition)
     {
-        Logger::info("FloorEntity attached to node: %s", ownerNode->getTag());
-        Assets::AssetRegistry *assetRegistry = payload.assetRegistry;
-
-        m_floorImage = assetRegistry->make<Assets::Image>(Assets::AssetMakeRequest{"assets/floor_stone.png"});
-        m_floorImage->load();
+        definition.imagePath = "assets/floor_stone.png";
+        definition.isStatic = true;
+        definition.renderLayer = "background";
+    }
 
-        m_tileWidth = static_cast<float>(m_floorImage->width);
+    void FloorEntity::onAttach(SceneNode *ownerNode, const AttachEventPayload &payload)
+    {
+        Logger::debug("FloorEntity attached to node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *floorSprite = PP_NEW(Sprite, m_floorImage);
-        if (!floorSprite->init(payload.renderer))
+        const Prefab *prefab = payload.prefab;
+        if (!prefab || !prefab->sprite)
         {
-            Logger::error("Failed to initialize floor sprite");
+            Logger::error("FloorEntity: Prefab has no sprite");
             return;
         }
 
-        ownerNode->setSprite(floorSprite);
+        m_tileWidth = static_cast<float>(prefab->image->width);
+
+        // The sprite is shared by every floor, it belongs to the prefab
+        ownerNode->setSprite(prefab->sprite);
     }
 
     void FloorEntity::onStart(SceneNode *ownerNode, const StartEventPayload &payload)
     {
         float scaleX = m_floorWidth / m_tileWidth;
-        ownerNode->m_scale = Math::Vector2<float>(scaleX, 1.0f);
+        ownerNode->setScale(Math::Vector2<float>(scaleX, 1.0f));
 
         Physics::PhysicsWorld *physicsWorld = payload.physicsWorld;
 
-        Math::Vector2<float> colliderPosition = ownerNode->m_position;
+        Math::Vector2<float> colliderPosition = ownerNode->getPosition();
         colliderPosition.y += 60.0f; // The sprite have transparency at the top and bottom, so we need to adjust the collider position
 
-        m_physicsComponent->initialize(physicsWorld, colliderPosition);
-        m_physicsComponent->setStatic(true);
+        m_physicsComponent.initialize(physicsWorld, colliderPosition);
+        m_physicsComponent.setStatic(true);
 
-        m_collider = m_physicsComponent->createBoxCollider(Math::Vector2<float>(m_floorWidth, m_floorHeight));
+        m_collider = m_physicsComponent.createBoxCollider(Math::Vector2<float>(m_floorWidth, m_floorHeight));
     }
 
     void FloorEntity::onDetach(SceneNode *ownerNode)
     {
-        Logger::info("FloorEntity detached from node: %s", ownerNode->getTag());
+        Logger::debug("FloorEntity detached from node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *sprite = ownerNode->getSprite();
-        if (sprite)
-        {
-            PP_DELETE(sprite);
-            ownerNode->setSprite(nullptr);
-        }
+        ownerNode->setSprite(nullptr);
     }
 }
@@ -5,7 +5,7 @@
 
 #include "../../Platform/Std.h"
 #include "../../Game/IEntity.h"
-#include "../../Assets/Image.h"
+#include "../../Game/Prefab.h"
 #include "../../Math/Vector2.h"
 #include "../../Physics/Collider.h"
 #include "../../Physics/RigidBody.h"
@@ -16,9 +16,8 @@ namespace PixelPulse::Entities
     class FloorEntity : public Game::IEntity
     {
     private:
-        Game::PhysicsComponent* m_physicsComponent;
+        Game::PhysicsComponent m_physicsComponent;
         Physics::BoxCollider* m_collider;
-        Assets::Image* m_floorImage;
         int m_tileCount;
         float m_tileWidth;
         float m_floorWidth;
@@ -32,6 +31,8 @@ namespace PixelPulse::Entities
         void onStart(Game::SceneNode *ownerNode, const Game::Events::StartEventPayload &payload) override;
         void onDetach(Game::SceneNode *ownerNode) override;
 
+        static void definePrefab(Game::PrefabDefinition &definition);
+
         static Game::EntityID getID()
         {
             return "FloorEntity";
@@ -2,7 +2,6 @@
 #include "../../Game/SceneNode.h"
 #include "../../Game/Events/UpdateEventPayload.h"
 #include "../../Game/Input.h"
-#include "../../Assets/Image.h"
 #include "../../Game/Sprite.h"
 #include "../../Game/EntityLibrary.h"
 
@@ -42,38 +41,37 @@ namespace PixelPulse::Entities
             movementDelta.x += m_moveSpeed * deltaTime;
         }
 
-        ownerNode->m_position += movementDelta;
+        ownerNode->translate(movementDelta);
     }
 
-    void PlayerEntity::onAttach(SceneNode *ownerNode, const AttachEventPayload &payload)
+    void PlayerEntity::definePrefab(PrefabDefinition &definition)
     {
-        Logger::info("PlayerEntity attached to node: %s", ownerNode->getTag());
-        Assets::AssetRegistry *assetRegistry = payload.assetRegistry;
+        definition.imagePath = "assets/vampire.png";
+        definition.scale = Math::Vector2<float>(0.2f, 0.2f);
+        definition.renderLayer = "actors";
+    }
 
-        m_playerImage = assetRegistry->make<Assets::Image>(Assets::AssetMakeRequest{"assets/vampire.png"});
-        m_playerImage->load();
+    void PlayerEntity::onAttach(SceneNode *ownerNode, const AttachEventPayload &payload)
+    {
+        Logger::debug("PlayerEntity attached to node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *vampireSprite = PP_NEW(Sprite, m_playerImage);
-        if (!vampireSprite->init(payload.renderer))
+        const Prefab *prefab = payload.prefab;
+        if (!prefab || !prefab->sprite)
         {
-            Logger::error("Failed to initialize sprite");
+            Logger::error("PlayerEntity: Prefab has no sprite");
             return;
         }
 
-        ownerNode->setSprite(vampireSprite);
-        ownerNode->m_position = Math::Vector2<float>(100, 100);
-        ownerNode->m_scale = Math::Vector2<float>(0.2f, 0.2f);
+        // The sprite is shared by every player, it belongs to the prefab
+        ownerNode->setSprite(prefab->sprite);
+        ownerNode->setPosition(Math::Vector2<float>(100, 100));
+        ownerNode->setScale(prefab->definition.scale);
     }
 
     void PlayerEntity::onDetach(SceneNode *ownerNode)
     {
-        Logger::info("PlayerEntity detached from node: %s", ownerNode->getTag());
+        Logger::debug("PlayerEntity detached from node: %s", ownerNode->getTag() ? ownerNode->getTag() : "untagged");
 
-        Sprite *sprite = ownerNode->getSprite();
-        if (sprite)
-        {
-            PP_DELETE(sprite);
-            ownerNode->setSprite(nullptr);
-        }
+        ownerNode->setSprite(nullptr);
     }
 }
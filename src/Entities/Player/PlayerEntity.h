@@ -5,7 +5,7 @@
 
 #include "../../Platform/Std.h"
 #include "../../Game/IEntity.h"
-#include "../../Assets/Image.h"
+#include "../../Game/Prefab.h"
 #include "../../Math/Vector2.h"
 
 namespace PixelPulse::Entities
@@ -14,16 +14,20 @@ namespace PixelPulse::Entities
     {
     private:
         float m_moveSpeed;
-        Assets::Image *m_playerImage;
 
     public:
         PlayerEntity();
         virtual ~PlayerEntity() = default;
 
+        // Reads input and moves its own node only
+        static constexpr bool ThreadSafeUpdate = true;
+
         void onUpdate(Game::SceneNode *ownerNode, const Game::Events::UpdateEventPayload &payload) override;
         void onAttach(Game::SceneNode *ownerNode, const Game::Events::AttachEventPayload &payload) override;
         void onDetach(Game::SceneNode *ownerNode) override;
 
+        static void definePrefab(Game::PrefabDefinition &definition);
+
         static Game::EntityID getID()
         {
             return "PlayerEntity";
@@ -0,0 +1,52 @@
+#include "Camera.h"
+
+namespace PixelPulse::Game
+{
+    Camera::Camera() : m_position(0.0f, 0.0f),
+                       m_anchor(0.0f, 0.0f),
+                       m_virtualResolution(1280.0f, 720.0f),
+                       m_zoom(1.0f)
+    {
+    }
+
+    void Camera::setZoom(float zoom)
+    {
+        if (zoom > 0.0f)
+        {
+            m_zoom = zoom;
+        }
+    }
+
+    void Camera::setVirtualResolution(const Math::Vector2<float> &virtualResolution)
+    {
+        if (virtualResolution.x > 0.0f && virtualResolution.y > 0.0f)
+        {
+            m_virtualResolution = virtualResolution;
+        }
+    }
+
+    ViewProjection Camera::getViewProjection(const Math::Vector2<std::int32_t> &windowSize) const
+    {
+        float windowWidth = static_cast<float>(windowSize.x);
+        float windowHeight = static_cast<float>(windowSize.y);
+
+        ViewProjection viewProjection;
+        viewProjection.scale = std::min(windowWidth / m_virtualResolution.x, windowHeight / m_virtualResolution.y) * m_zoom;
+        viewProjection.offset.x = windowWidth * m_anchor.x - m_position.x * viewProjection.scale;
+        viewProjection.offset.y = windowHeight * m_anchor.y - m_position.y * viewProjection.scale;
+        return viewProjection;
+    }
+
+    SDL_FRect Camera::getViewRect(const Math::Vector2<std::int32_t> &windowSize) const
+    {
+        ViewProjection viewProjection = getViewProjection(windowSize);
+        if (viewProjection.scale <= 0.0f)
+        {
+            return SDL_FRect{m_position.x, m_position.y, 0.0f, 0.0f};
+        }
+
+        float width = static_cast<float>(windowSize.x) / viewProjection.scale;
+        float height = static_cast<float>(windowSize.y) / viewProjection.scale;
+        return SDL_FRect{m_position.x - width * m_anchor.x, m_position.y - height * m_anchor.y, width, height};
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef PIXELPULSE_CAMERA_H
+#define PIXELPULSE_CAMERA_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Math/Vector2.h"
+
+namespace PixelPulse::Game
+{
+    // World to screen mapping of one frame: screen = world * scale + offset
+    struct ViewProjection
+    {
+        float scale = 1.0f;
+        Math::Vector2<float> offset;
+
+        SDL_FRect apply(const SDL_FRect &world) const
+        {
+            return SDL_FRect{world.x * scale + offset.x, world.y * scale + offset.y, world.w * scale, world.h * scale};
+        }
+    };
+
+    // The virtual resolution is the world area shown at zoom 1, scaled uniformly to fit the
+    // window. The position is the world point shown at the anchor, a point of the window in
+    // fractions of its size that zoom also scales around. By default the anchor is the top left
+    // and the position (0, 0), so extra window space goes to the right and bottom; an anchor of
+    // (0.5, 0.5) centers the position instead.
+    // Moving the camera only changes the per-frame view-projection, nodes are not touched.
+    class Camera
+    {
+    public:
+        Camera();
+
+        void setPosition(const Math::Vector2<float> &position) { m_position = position; }
+        const Math::Vector2<float> &getPosition() const { return m_position; }
+        void translate(const Math::Vector2<float> &delta) { m_position += delta; }
+
+        // Values at or below zero are ignored
+        void setZoom(float zoom);
+        float getZoom() const { return m_zoom; }
+
+        void setAnchor(const Math::Vector2<float> &anchor) { m_anchor = anchor; }
+        const Math::Vector2<float> &getAnchor() const { return m_anchor; }
+
+        void setVirtualResolution(const Math::Vector2<float> &virtualResolution);
+        const Math::Vector2<float> &getVirtualResolution() const { return m_virtualResolution; }
+
+        ViewProjection getViewProjection(const Math::Vector2<std::int32_t> &windowSize) const;
+
+        // World rectangle covered by the window
+        SDL_FRect getViewRect(const Math::Vector2<std::int32_t> &windowSize) const;
+
+    private:
+        Math::Vector2<float> m_position;
+        Math::Vector2<float> m_anchor;
+        Math::Vector2<float> m_virtualResolution;
+        float m_zoom;
+    };
+}
+
+#endif
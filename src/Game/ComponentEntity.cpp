@@ -0,0 +1,45 @@
+#include "ComponentEntity.h"
+#include "SceneNode.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    void ComponentEntity::onAttach(SceneNode *ownerNode, const Events::AttachEventPayload &payload)
+    {
+        if (!payload.components)
+        {
+            Logger::error("ComponentEntity::onAttach: Scene has no component registry");
+            return;
+        }
+
+        m_components = payload.components;
+        m_handle = m_components->create();
+        m_components->add<NodeLinkComponent>(m_handle, ownerNode);
+        m_components->add<PositionComponent>(m_handle, ownerNode->getPosition());
+    }
+
+    void ComponentEntity::onStart(SceneNode *ownerNode, const Events::StartEventPayload &payload)
+    {
+        PIXELPULSE_ARG_UNUSED(payload);
+
+        if (!m_components)
+        {
+            return;
+        }
+
+        m_components->add<PositionComponent>(m_handle, ownerNode->getPosition());
+        m_components->add<ScaleComponent>(m_handle, ownerNode->getScale());
+    }
+
+    void ComponentEntity::onDetach(SceneNode *ownerNode)
+    {
+        PIXELPULSE_ARG_UNUSED(ownerNode);
+
+        if (m_components)
+        {
+            m_components->destroy(m_handle);
+            m_components = nullptr;
+            m_handle = EntityHandle();
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#ifndef PIXELPULSE_COMPONENTENTITY_H
+#define PIXELPULSE_COMPONENTENTITY_H
+
+#include "IEntity.h"
+#include "ComponentRegistry.h"
+#include "Components.h"
+
+namespace PixelPulse::Game
+{
+    // Adapter for migrating IEntity types to component storage one at a time. The entity keeps
+    // its node and callbacks, but its hot data lives in the scene's ComponentRegistry where the
+    // systems process it with everything else of the same kind. The component entity is linked
+    // to the owner node, whose position mirrors PositionComponent. Sprites are drawn at
+    // PositionComponent without the node's parent transform, so owner nodes should be attached
+    // to the scene root.
+    //
+    // Subclasses overriding the callbacks must call the ComponentEntity versions.
+    class ComponentEntity : public IEntity
+    {
+    public:
+        // Creates the component entity with a NodeLink and a Position
+        void onAttach(SceneNode *ownerNode, const Events::AttachEventPayload &payload) override;
+
+        // Refreshes Position and Scale from the node, which scene loading sets after attaching
+        void onStart(SceneNode *ownerNode, const Events::StartEventPayload &payload) override;
+
+        // Destroys the component entity
+        void onDetach(SceneNode *ownerNode) override;
+
+        EntityHandle getHandle() const { return m_handle; }
+
+    protected:
+        ComponentRegistry *m_components = nullptr;
+        EntityHandle m_handle;
+    };
+}
+
+#endif
@@ -0,0 +1,284 @@
+#pragma once
+
+#ifndef PIXELPULSE_COMPONENTREGISTRY_H
+#define PIXELPULSE_COMPONENTREGISTRY_H
+
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+
+namespace PixelPulse::Game
+{
+    // Handle to an entity of a ComponentRegistry. Slots are reused after destroy(), the generation
+    // tells a stale handle apart from the slot's current occupant.
+    struct EntityHandle
+    {
+        static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t index = InvalidIndex;
+        std::uint32_t generation = 0;
+
+        bool isValid() const { return index != InvalidIndex; }
+        bool operator==(const EntityHandle &other) const = default;
+    };
+
+    typedef std::uint32_t ComponentTypeId;
+
+    inline ComponentTypeId nextComponentTypeId()
+    {
+        static ComponentTypeId nextId = 0;
+        return nextId++;
+    }
+
+    // Dense per-type index, assigned on first use
+    template <typename T>
+    ComponentTypeId getComponentTypeId()
+    {
+        static const ComponentTypeId id = nextComponentTypeId();
+        return id;
+    }
+
+    class IComponentPool
+    {
+    public:
+        virtual ~IComponentPool() = default;
+
+        virtual bool contains(std::uint32_t entityIndex) const = 0;
+        virtual void remove(std::uint32_t entityIndex) = 0;
+    };
+
+    // Sparse set: components are packed in a dense array, the sparse array maps an entity index
+    // to its component's dense index. Removal moves the last component into the hole, so it is
+    // O(1) and the dense array never has gaps.
+    template <typename T>
+    class ComponentPool : public IComponentPool
+    {
+    public:
+        template <typename... Args>
+        T &add(std::uint32_t entityIndex, Args &&...args)
+        {
+            if (contains(entityIndex))
+            {
+                T &component = m_components[m_sparse[entityIndex]];
+                component = T{std::forward<Args>(args)...};
+                return component;
+            }
+
+            if (entityIndex >= m_sparse.size())
+            {
+                m_sparse.resize(entityIndex + 1, Absent);
+            }
+
+            m_sparse[entityIndex] = static_cast<std::uint32_t>(m_components.size());
+            m_entities.push_back(entityIndex);
+            m_components.push_back(T{std::forward<Args>(args)...});
+            return m_components.back();
+        }
+
+        bool contains(std::uint32_t entityIndex) const override
+        {
+            return entityIndex < m_sparse.size() && m_sparse[entityIndex] != Absent;
+        }
+
+        void remove(std::uint32_t entityIndex) override
+        {
+            if (!contains(entityIndex))
+            {
+                return;
+            }
+
+            std::uint32_t denseIndex = m_sparse[entityIndex];
+            std::uint32_t lastIndex = static_cast<std::uint32_t>(m_components.size() - 1);
+            if (denseIndex != lastIndex)
+            {
+                m_components[denseIndex] = std::move(m_components[lastIndex]);
+                m_entities[denseIndex] = m_entities[lastIndex];
+                m_sparse[m_entities[denseIndex]] = denseIndex;
+            }
+
+            m_components.pop_back();
+            m_entities.pop_back();
+            m_sparse[entityIndex] = Absent;
+        }
+
+        T *get(std::uint32_t entityIndex)
+        {
+            return contains(entityIndex) ? &m_components[m_sparse[entityIndex]] : nullptr;
+        }
+
+        const T *get(std::uint32_t entityIndex) const
+        {
+            return contains(entityIndex) ? &m_components[m_sparse[entityIndex]] : nullptr;
+        }
+
+        std::size_t size() const { return m_components.size(); }
+
+        // Dense arrays, component i belongs to entity index getEntities()[i]
+        T *getComponents() { return m_components.data(); }
+        const std::uint32_t *getEntities() const { return m_entities.data(); }
+
+    private:
+        static constexpr std::uint32_t Absent = std::numeric_limits<std::uint32_t>::max();
+
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_sparse;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_entities;
+        Platform::Vector<T, Platform::Memory::MemoryTag::Scene> m_components;
+    };
+
+    // Component storage for entities that are plain IDs rather than IEntity objects. Systems
+    // iterate the dense component arrays with each<>(), see ComponentSystems.h.
+    class ComponentRegistry
+    {
+    public:
+        ComponentRegistry() = default;
+        ComponentRegistry(const ComponentRegistry &) = delete;
+        ComponentRegistry &operator=(const ComponentRegistry &) = delete;
+
+        ~ComponentRegistry()
+        {
+            for (IComponentPool *pool : m_pools)
+            {
+                PP_DELETE(pool);
+            }
+            m_pools.clear();
+        }
+
+        EntityHandle create()
+        {
+            EntityHandle handle;
+            if (!m_freeSlots.empty())
+            {
+                handle.index = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                handle.index = static_cast<std::uint32_t>(m_generations.size());
+                m_generations.push_back(0);
+                m_alive.push_back(0);
+            }
+
+            handle.generation = m_generations[handle.index];
+            m_alive[handle.index] = 1;
+            m_aliveCount++;
+            return handle;
+        }
+
+        // Removes all components of the entity and recycles its slot
+        void destroy(EntityHandle handle)
+        {
+            if (!isAlive(handle))
+            {
+                return;
+            }
+
+            for (IComponentPool *pool : m_pools)
+            {
+                if (pool)
+                {
+                    pool->remove(handle.index);
+                }
+            }
+
+            m_alive[handle.index] = 0;
+            m_generations[handle.index]++;
+            m_freeSlots.push_back(handle.index);
+            m_aliveCount--;
+        }
+
+        bool isAlive(EntityHandle handle) const
+        {
+            return handle.index < m_generations.size() &&
+                   m_alive[handle.index] &&
+                   m_generations[handle.index] == handle.generation;
+        }
+
+        std::size_t getAliveCount() const { return m_aliveCount; }
+
+        // Adds the component, or overwrites it if the entity already has one
+        template <typename T, typename... Args>
+        T &add(EntityHandle handle, Args &&...args)
+        {
+            return getPool<T>().add(handle.index, std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void remove(EntityHandle handle)
+        {
+            if (isAlive(handle))
+            {
+                getPool<T>().remove(handle.index);
+            }
+        }
+
+        template <typename T>
+        T *get(EntityHandle handle)
+        {
+            return isAlive(handle) ? getPool<T>().get(handle.index) : nullptr;
+        }
+
+        template <typename T>
+        bool has(EntityHandle handle) const
+        {
+            const IComponentPool *pool = findPool(getComponentTypeId<T>());
+            return pool && isAlive(handle) && pool->contains(handle.index);
+        }
+
+        template <typename T>
+        ComponentPool<T> &getPool()
+        {
+            ComponentTypeId typeId = getComponentTypeId<T>();
+            if (typeId >= m_pools.size())
+            {
+                m_pools.resize(typeId + 1, nullptr);
+            }
+
+            if (!m_pools[typeId])
+            {
+                m_pools[typeId] = PP_NEW(ComponentPool<T>);
+            }
+
+            return *static_cast<ComponentPool<T> *>(m_pools[typeId]);
+        }
+
+        // Calls fn(EntityHandle, First &, Rest &...) for every entity that has all the listed
+        // components, walking the dense array of First, so First should be the rarest type.
+        // fn must not add or remove components of the listed types.
+        template <typename First, typename... Rest, typename Function>
+        void each(Function &&fn)
+        {
+            ComponentPool<First> &first = getPool<First>();
+            std::tuple<ComponentPool<Rest> &...> rest(getPool<Rest>()...);
+
+            First *components = first.getComponents();
+            const std::uint32_t *entities = first.getEntities();
+            std::size_t count = first.size();
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint32_t entityIndex = entities[i];
+                if ((std::get<ComponentPool<Rest> &>(rest).contains(entityIndex) && ...))
+                {
+                    EntityHandle handle;
+                    handle.index = entityIndex;
+                    handle.generation = m_generations[entityIndex];
+
+                    fn(handle, components[i], *std::get<ComponentPool<Rest> &>(rest).get(entityIndex)...);
+                }
+            }
+        }
+
+    private:
+        const IComponentPool *findPool(ComponentTypeId typeId) const
+        {
+            return typeId < m_pools.size() ? m_pools[typeId] : nullptr;
+        }
+
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_generations;
+        Platform::Vector<std::uint8_t, Platform::Memory::MemoryTag::Scene> m_alive;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_freeSlots;
+        Platform::Vector<IComponentPool *, Platform::Memory::MemoryTag::Scene> m_pools;
+        std::size_t m_aliveCount = 0;
+    };
+}
+
+#endif
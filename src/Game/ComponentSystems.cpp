@@ -0,0 +1,75 @@
+#include "ComponentSystems.h"
+#include "SceneNode.h"
+#include "Sprite.h"
+#include "CullingGrid.h"
+#include "../Physics/RigidBody.h"
+
+namespace PixelPulse::Game::Systems
+{
+    void integrateVelocities(ComponentRegistry &registry, float deltaTime)
+    {
+        registry.each<VelocityComponent, PositionComponent>(
+            [deltaTime](EntityHandle, VelocityComponent &velocity, PositionComponent &position)
+            {
+                position.value += velocity.value * deltaTime;
+            });
+    }
+
+    void syncRigidBodies(ComponentRegistry &registry)
+    {
+        registry.each<RigidBodyComponent, PositionComponent>(
+            [](EntityHandle, RigidBodyComponent &rigidBody, PositionComponent &position)
+            {
+                position.value = rigidBody.body->getPosition();
+            });
+    }
+
+    void syncLinkedNodes(ComponentRegistry &registry)
+    {
+        registry.each<NodeLinkComponent, PositionComponent>(
+            [](EntityHandle, NodeLinkComponent &link, PositionComponent &position)
+            {
+                if (link.node->getPosition() != position.value)
+                {
+                    link.node->setPosition(position.value);
+                }
+            });
+    }
+
+    std::uint32_t extractSprites(ComponentRegistry &registry, RenderCommandBuffer &commands, const RenderLayers &layers, const SDL_FRect *view)
+    {
+        ComponentPool<ScaleComponent> &scales = registry.getPool<ScaleComponent>();
+        ComponentPool<NodeLinkComponent> &links = registry.getPool<NodeLinkComponent>();
+        float ySortOrigin = RenderLayers::getYSortOrigin(view);
+        std::uint32_t culled = 0;
+
+        registry.each<SpriteComponent, PositionComponent>(
+            [&](EntityHandle handle, SpriteComponent &sprite, PositionComponent &position)
+            {
+                Math::Vector2<float> scale(1.0f, 1.0f);
+                if (const ScaleComponent *scaleComponent = scales.get(handle.index))
+                {
+                    scale = scaleComponent->value;
+                }
+
+                SDL_FRect bounds = sprite.sprite->getWorldRect(position.value, scale);
+                if (view && !intersects(bounds, *view))
+                {
+                    culled++;
+                    return;
+                }
+
+                std::uint8_t layer = 0;
+                std::int16_t z = 0;
+                if (const NodeLinkComponent *link = links.get(handle.index))
+                {
+                    layer = link->node->getRenderLayer();
+                    z = link->node->getZOrder();
+                }
+
+                commands.add(sprite.sprite->getTexture(), bounds, &sprite.sprite->getSource(), layer, layers.getDepth(layer, z, bounds, ySortOrigin));
+            });
+
+        return culled;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef PIXELPULSE_COMPONENTSYSTEMS_H
+#define PIXELPULSE_COMPONENTSYSTEMS_H
+
+#include "ComponentRegistry.h"
+#include "Components.h"
+#include "RenderCommand.h"
+#include "RenderLayers.h"
+
+namespace PixelPulse::Game::Systems
+{
+    // Entity logic phase: Position += Velocity * deltaTime
+    void integrateVelocities(ComponentRegistry &registry, float deltaTime);
+
+    // Physics sync phase: Position = RigidBody position
+    void syncRigidBodies(ComponentRegistry &registry);
+
+    // Physics sync phase: linked nodes take the entity's Position, unchanged nodes stay clean
+    void syncLinkedNodes(ComponentRegistry &registry);
+
+    // Render extraction phase: emits a render command for every entity with a Sprite and a Position
+    // whose bounds overlap the view (all of them if view is null), returns the number culled.
+    // Entities linked to a node draw on the node's layer and z, the others on layer 0.
+    std::uint32_t extractSprites(ComponentRegistry &registry, RenderCommandBuffer &commands, const RenderLayers &layers, const SDL_FRect *view);
+}
+
+#endif
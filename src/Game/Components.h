@@ -0,0 +1,59 @@
+#pragma once
+
+#ifndef PIXELPULSE_COMPONENTS_H
+#define PIXELPULSE_COMPONENTS_H
+
+#include "../Platform/Std.h"
+#include "../Math/Vector2.h"
+
+namespace PixelPulse::Physics
+{
+    class RigidBody;
+}
+
+namespace PixelPulse::Game
+{
+    class Sprite;
+    class SceneNode;
+
+    // Components are plain data stored in a ComponentRegistry, pointers are not owned
+
+    struct PositionComponent
+    {
+        Math::Vector2<float> value;
+    };
+
+    struct ScaleComponent
+    {
+        Math::Vector2<float> value = Math::Vector2<float>(1.0f, 1.0f);
+    };
+
+    struct VelocityComponent
+    {
+        Math::Vector2<float> value;
+    };
+
+    struct SpriteComponent
+    {
+        Sprite *sprite;
+    };
+
+    // Position follows the body during the physics sync phase
+    struct RigidBodyComponent
+    {
+        Physics::RigidBody *body;
+    };
+
+    struct TagComponent
+    {
+        const char *tag;
+    };
+
+    // Ties a component entity to a scene node, the node's position mirrors PositionComponent
+    struct NodeLinkComponent
+    {
+        SceneNode *node;
+    };
+}
+
+#endif
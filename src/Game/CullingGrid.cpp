@@ -0,0 +1,143 @@
+#include "CullingGrid.h"
+
+#include <cmath>
+
+namespace PixelPulse::Game
+{
+    void CullingGrid::build(std::span<const SDL_FRect> bounds, float cellSize)
+    {
+        clear();
+        if (bounds.empty())
+        {
+            return;
+        }
+
+        float minX = bounds[0].x;
+        float minY = bounds[0].y;
+        float maxX = bounds[0].x + bounds[0].w;
+        float maxY = bounds[0].y + bounds[0].h;
+        for (const SDL_FRect &rect : bounds)
+        {
+            minX = std::min(minX, rect.x);
+            minY = std::min(minY, rect.y);
+            maxX = std::max(maxX, rect.x + rect.w);
+            maxY = std::max(maxY, rect.y + rect.h);
+        }
+
+        // Sparse levels would otherwise get a huge, mostly empty grid
+        m_cellSize = std::max(cellSize, 1.0f);
+        float area = std::max(maxX - minX, 1.0f) * std::max(maxY - minY, 1.0f);
+        m_cellSize = std::max(m_cellSize, std::sqrt(area / static_cast<float>(MaxCells)));
+
+        m_originX = minX;
+        m_originY = minY;
+        m_columns = static_cast<std::int32_t>((maxX - minX) / m_cellSize) + 1;
+        m_rows = static_cast<std::int32_t>((maxY - minY) / m_cellSize) + 1;
+
+        std::size_t cellCount = static_cast<std::size_t>(m_columns) * static_cast<std::size_t>(m_rows);
+        m_cellStarts.assign(cellCount + 1, 0);
+
+        // Count per cell, turn the counts into offsets, then fill
+        std::int32_t minColumn, minRow, maxColumn, maxRow;
+        for (const SDL_FRect &rect : bounds)
+        {
+            getCellRange(rect, minColumn, minRow, maxColumn, maxRow);
+            for (std::int32_t row = minRow; row <= maxRow; ++row)
+            {
+                for (std::int32_t column = minColumn; column <= maxColumn; ++column)
+                {
+                    m_cellStarts[static_cast<std::size_t>(row * m_columns + column) + 1]++;
+                }
+            }
+        }
+
+        for (std::size_t cell = 0; cell < cellCount; ++cell)
+        {
+            m_cellStarts[cell + 1] += m_cellStarts[cell];
+        }
+
+        m_items.resize(m_cellStarts[cellCount]);
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> cursors(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+        for (std::uint32_t item = 0; item < bounds.size(); ++item)
+        {
+            getCellRange(bounds[item], minColumn, minRow, maxColumn, maxRow);
+            for (std::int32_t row = minRow; row <= maxRow; ++row)
+            {
+                for (std::int32_t column = minColumn; column <= maxColumn; ++column)
+                {
+                    m_items[cursors[static_cast<std::size_t>(row * m_columns + column)]++] = item;
+                }
+            }
+        }
+
+        m_stamps.assign(bounds.size(), 0);
+        m_stamp = 0;
+    }
+
+    void CullingGrid::clear()
+    {
+        m_columns = 0;
+        m_rows = 0;
+        m_cellStarts.clear();
+        m_items.clear();
+        m_stamps.clear();
+        m_stamp = 0;
+    }
+
+    void CullingGrid::query(const SDL_FRect &view, Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> &results)
+    {
+        std::int32_t minColumn, minRow, maxColumn, maxRow;
+        if (m_stamps.empty() || !getCellRange(view, minColumn, minRow, maxColumn, maxRow))
+        {
+            return;
+        }
+
+        // Stamps are never 0 after a bump, so a wrap only needs the array reset
+        if (++m_stamp == 0)
+        {
+            std::fill(m_stamps.begin(), m_stamps.end(), 0);
+            m_stamp = 1;
+        }
+
+        std::size_t first = results.size();
+        for (std::int32_t row = minRow; row <= maxRow; ++row)
+        {
+            std::uint32_t begin = m_cellStarts[static_cast<std::size_t>(row * m_columns + minColumn)];
+            std::uint32_t end = m_cellStarts[static_cast<std::size_t>(row * m_columns + maxColumn) + 1];
+            for (std::uint32_t i = begin; i < end; ++i)
+            {
+                std::uint32_t item = m_items[i];
+                if (m_stamps[item] != m_stamp)
+                {
+                    m_stamps[item] = m_stamp;
+                    results.push_back(item);
+                }
+            }
+        }
+
+        std::sort(results.begin() + static_cast<std::ptrdiff_t>(first), results.end());
+    }
+
+    bool CullingGrid::getCellRange(const SDL_FRect &rect, std::int32_t &minColumn, std::int32_t &minRow, std::int32_t &maxColumn, std::int32_t &maxRow) const
+    {
+        float left = (rect.x - m_originX) / m_cellSize;
+        float top = (rect.y - m_originY) / m_cellSize;
+        float right = (rect.x + rect.w - m_originX) / m_cellSize;
+        float bottom = (rect.y + rect.h - m_originY) / m_cellSize;
+
+        if (right < 0.0f || bottom < 0.0f || left >= static_cast<float>(m_columns) || top >= static_cast<float>(m_rows))
+        {
+            return false;
+        }
+
+        // Clamped before the conversion, an unbounded view would not fit an int
+        float lastColumn = static_cast<float>(m_columns - 1);
+        float lastRow = static_cast<float>(m_rows - 1);
+        minColumn = static_cast<std::int32_t>(std::clamp(left, 0.0f, lastColumn));
+        minRow = static_cast<std::int32_t>(std::clamp(top, 0.0f, lastRow));
+        maxColumn = static_cast<std::int32_t>(std::clamp(right, 0.0f, lastColumn));
+        maxRow = static_cast<std::int32_t>(std::clamp(bottom, 0.0f, lastRow));
+        return true;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef PIXELPULSE_CULLINGGRID_H
+#define PIXELPULSE_CULLINGGRID_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+
+namespace PixelPulse::Game
+{
+    inline bool intersects(const SDL_FRect &a, const SDL_FRect &b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    // Uniform grid over a fixed set of world rectangles, for culling sprites that do not move.
+    // Cells are stored as one flat array of item indices with per-cell offsets, so a build is
+    // two passes and a query only touches the cells under the view. Items spanning several
+    // cells are reported once per query.
+    class CullingGrid
+    {
+    public:
+        static constexpr float DefaultCellSize = 256.0f;
+        static constexpr std::uint32_t MaxCells = 1u << 16; // Cells grow past the default size to stay under this
+
+        // Item i is bounds[i], replaces any previous contents
+        void build(std::span<const SDL_FRect> bounds, float cellSize = DefaultCellSize);
+        void clear();
+
+        // Appends the items whose cells overlap view, in ascending order. Their bounds still
+        // need testing against the view, a cell is coarser than the items in it.
+        void query(const SDL_FRect &view, Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> &results);
+
+        std::size_t getItemCount() const { return m_stamps.size(); }
+
+    private:
+        // Clamped cell range covered by rect, false if it misses the grid
+        bool getCellRange(const SDL_FRect &rect, std::int32_t &minColumn, std::int32_t &minRow, std::int32_t &maxColumn, std::int32_t &maxRow) const;
+
+        float m_cellSize = DefaultCellSize;
+        float m_originX = 0.0f;
+        float m_originY = 0.0f;
+        std::int32_t m_columns = 0;
+        std::int32_t m_rows = 0;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_cellStarts; // Cell c holds m_items[m_cellStarts[c], m_cellStarts[c + 1])
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_items;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_stamps; // Last query that reported each item
+        std::uint32_t m_stamp = 0;
+    };
+}
+
+#endif
@@ -4,18 +4,98 @@
 #define PIXELPULSE_ENTITY_LIBRARY_H
 
 #include "IEntity.h"
+#include "SceneNode.h"
+#include "EntityPool.h"
+#include "Prefab.h"
 #include "../Platform/Std.h"
+#include "../Platform/Containers.h"
 
 namespace PixelPulse::Game
 {
+    // Updates every instance of one entity type, nodes all carry an entity of that type
+    using EntityUpdateBatchFunction = void (*)(std::span<SceneNode *const> nodes, const Events::UpdateEventPayload &payload);
+
+    // Calls onUpdate through the vtable, used for entities whose concrete type is unknown
+    inline void updateEntityBatchVirtual(std::span<SceneNode *const> nodes, const Events::UpdateEventPayload &payload)
+    {
+        for (SceneNode *node : nodes)
+        {
+            node->getEntity()->onUpdate(node, payload);
+        }
+    }
+
+    // Types can process all their instances at once by providing
+    // static void updateBatch(std::span<SceneNode *const>, const Events::UpdateEventPayload &),
+    // otherwise each instance's onUpdate is called without virtual dispatch
+    template <typename EntityClass>
+    void updateEntityBatch(std::span<SceneNode *const> nodes, const Events::UpdateEventPayload &payload)
+    {
+        if constexpr (requires { EntityClass::updateBatch(nodes, payload); })
+        {
+            EntityClass::updateBatch(nodes, payload);
+        }
+        else
+        {
+            for (SceneNode *node : nodes)
+            {
+                static_cast<EntityClass *>(node->getEntity())->EntityClass::onUpdate(node, payload);
+            }
+        }
+    }
+
+    // A type that does not override onUpdate still names IEntity::onUpdate
+    template <typename EntityClass>
+    constexpr bool hasEntityUpdate = !std::is_same_v<decltype(&EntityClass::onUpdate), decltype(&IEntity::onUpdate)>;
+
+    // Types opt in to updating on job system threads with static constexpr bool ThreadSafeUpdate = true.
+    // Their update may only write to the instance and its own node, anything shared goes through
+    // payload.commands. Nodes of such a type must not be nested in one another.
+    template <typename EntityClass>
+    constexpr bool isEntityUpdateThreadSafe = requires { requires EntityClass::ThreadSafeUpdate; };
+
+    // Types with shared immutable data provide static void definePrefab(PrefabDefinition &)
+    template <typename EntityClass>
+    PrefabDefinition getEntityPrefabDefinition()
+    {
+        PrefabDefinition definition;
+        if constexpr (requires { EntityClass::definePrefab(definition); })
+        {
+            EntityClass::definePrefab(definition);
+        }
+        return definition;
+    }
+
+    template <typename EntityClass>
+    IEntityPool *createEntityPoolOf()
+    {
+        return PP_NEW(EntityPool<EntityClass>);
+    }
+
     class EntityLibrary
     {
     private:
         using EntityFactoryFunction = std::function<IEntity *()>;
+        using EntityPoolFactoryFunction = IEntityPool *(*)();
+
+        struct EntityType
+        {
+            std::string id;
+            EntityFactoryFunction factory;
+            EntityUpdateBatchFunction updateBatch; // Null if the type has no per-frame update
+            bool threadSafeUpdate;
+            PrefabDefinition prefab;
+            EntityPoolFactoryFunction createPool; // Null if instances can only come from the factory
+        };
 
-        std::unordered_map<std::string, EntityFactoryFunction> m_entityFactories;
+        // Registrations happen during static initialization and live until exit
+        Platform::Vector<EntityType, Platform::Memory::MemoryTag::Static> m_entityTypes;
+        Platform::UnorderedMap<std::string, EntityTypeIndex, Platform::Memory::MemoryTag::Static> m_entityTypeIndices;
 
-        EntityLibrary() = default;
+        EntityLibrary()
+        {
+            // Construct the allocator first so it is destroyed after the factory map
+            Platform::Memory::MemoryAllocator::getInstance();
+        }
 
         // No copy or move
         EntityLibrary(const EntityLibrary &) = delete;
@@ -30,7 +110,32 @@ namespace PixelPulse::Game
             return instance;
         }
 
-        bool registerEntity(const char *entityID, EntityFactoryFunction factoryFunc)
+        template <typename EntityClass>
+        bool registerEntityType()
+        {
+            EntityUpdateBatchFunction updateBatch = nullptr;
+            if constexpr (hasEntityUpdate<EntityClass>)
+            {
+                updateBatch = &updateEntityBatch<EntityClass>;
+            }
+
+            if (!registerEntity(
+                    EntityClass::getID(),
+                    []() -> IEntity * { return PP_NEW(EntityClass); },
+                    updateBatch,
+                    isEntityUpdateThreadSafe<EntityClass>))
+            {
+                return false;
+            }
+
+            EntityType &type = m_entityTypes.back();
+            type.prefab = getEntityPrefabDefinition<EntityClass>();
+            type.createPool = &createEntityPoolOf<EntityClass>;
+            return true;
+        }
+
+        // Without a batch function the type's instances are updated through the vtable
+        bool registerEntity(const char *entityID, EntityFactoryFunction factoryFunc, EntityUpdateBatchFunction updateBatch = &updateEntityBatchVirtual, bool threadSafeUpdate = false)
         {
             if (!entityID || !factoryFunc)
             {
@@ -40,35 +145,107 @@ namespace PixelPulse::Game
 
             std::string id(entityID);
 
-            if (m_entityFactories.find(id) != m_entityFactories.end())
+            if (m_entityTypeIndices.find(id) != m_entityTypeIndices.end())
             {
                 Logger::warning("EntityLibrary: Entity with ID '%s' is already registered", entityID);
                 return false;
             }
 
-            m_entityFactories[id] = factoryFunc;
+            m_entityTypeIndices[id] = static_cast<EntityTypeIndex>(m_entityTypes.size());
+            m_entityTypes.push_back(EntityType{id, factoryFunc, updateBatch, threadSafeUpdate, PrefabDefinition(), nullptr});
             Logger::info("EntityLibrary: Entity registered with ID: %s", entityID);
             return true;
         }
 
         IEntity *createEntity(const char *entityID)
         {
-            if (!entityID)
+            return createEntity(findEntityType(entityID));
+        }
+
+        // From the pool if one is given (see Prefab), otherwise through the type's factory
+        IEntity *createEntity(EntityTypeIndex typeIndex, IEntityPool *pool = nullptr)
+        {
+            if (typeIndex >= m_entityTypes.size())
             {
-                Logger::error("EntityLibrary: Attempted to create entity with null ID");
                 return nullptr;
             }
 
-            std::string id(entityID);
+            IEntity *entity = pool ? pool->create() : m_entityTypes[typeIndex].factory();
+            if (entity)
+            {
+                entity->m_typeIndex = typeIndex;
+                entity->m_pool = pool;
+            }
+            return entity;
+        }
+
+        // Returns the entity to the pool it came from, or deletes it
+        static void destroyEntity(IEntity *entity)
+        {
+            if (!entity)
+            {
+                return;
+            }
+
+            if (entity->m_pool)
+            {
+                entity->m_pool->destroy(entity);
+            }
+            else
+            {
+                PP_DELETE(entity);
+            }
+        }
+
+        EntityTypeIndex findEntityType(const char *entityID) const
+        {
+            if (!entityID)
+            {
+                Logger::error("EntityLibrary: Attempted to find entity type with null ID");
+                return InvalidEntityTypeIndex;
+            }
 
-            auto it = m_entityFactories.find(id);
-            if (it == m_entityFactories.end())
+            auto it = m_entityTypeIndices.find(std::string(entityID));
+            if (it == m_entityTypeIndices.end())
             {
                 Logger::error("EntityLibrary: No entity registered with ID: %s", entityID);
+                return InvalidEntityTypeIndex;
+            }
+
+            return it->second;
+        }
+
+        // Null for an unknown type, types without definePrefab have a default definition
+        const PrefabDefinition *getPrefabDefinition(EntityTypeIndex typeIndex) const
+        {
+            return typeIndex < m_entityTypes.size() ? &m_entityTypes[typeIndex].prefab : nullptr;
+        }
+
+        // Null if the type was registered with a custom factory
+        IEntityPool *createEntityPool(EntityTypeIndex typeIndex) const
+        {
+            if (typeIndex >= m_entityTypes.size() || !m_entityTypes[typeIndex].createPool)
+            {
                 return nullptr;
             }
 
-            return it->second();
+            return m_entityTypes[typeIndex].createPool();
+        }
+
+        // Unknown types fall back to virtual dispatch, null means instances need no update
+        EntityUpdateBatchFunction getUpdateBatchFunction(EntityTypeIndex typeIndex) const
+        {
+            if (typeIndex >= m_entityTypes.size())
+            {
+                return &updateEntityBatchVirtual;
+            }
+
+            return m_entityTypes[typeIndex].updateBatch;
+        }
+
+        bool isUpdateThreadSafe(EntityTypeIndex typeIndex) const
+        {
+            return typeIndex < m_entityTypes.size() && m_entityTypes[typeIndex].threadSafeUpdate;
         }
 
         bool isEntityRegistered(const char *entityID)
@@ -80,30 +257,28 @@ namespace PixelPulse::Game
             }
 
             std::string id(entityID);
-            return m_entityFactories.find(id) != m_entityFactories.end();
+            return m_entityTypeIndices.find(id) != m_entityTypeIndices.end();
         }
 
         std::vector<const char *> getRegisteredEntityIDs() const
         {
             std::vector<const char *> ids;
-            ids.reserve(m_entityFactories.size());
+            ids.reserve(m_entityTypes.size());
 
-            for (const auto &pair : m_entityFactories)
+            for (const EntityType &type : m_entityTypes)
             {
-                ids.push_back(pair.first.c_str());
+                ids.push_back(type.id.c_str());
             }
 
             return ids;
         }
     };
 
-#define PIXELPULSE_REGISTER_ENTITY(EntityClass)                                                \
-    namespace                                                                       \
-    {                                                                               \
-        static bool EntityClass##_registered =                                      \
-            PixelPulse::Game::EntityLibrary::getInstance().registerEntity(          \
-                EntityClass::getID(),                                               \
-                []() -> PixelPulse::Game::IEntity * { return PP_NEW(EntityClass); }); \
+#define PIXELPULSE_REGISTER_ENTITY(EntityClass)                                               \
+    namespace                                                                                 \
+    {                                                                                         \
+        static bool EntityClass##_registered =                                                \
+            PixelPulse::Game::EntityLibrary::getInstance().registerEntityType<EntityClass>(); \
     }
 }
 
@@ -0,0 +1,33 @@
+#pragma once
+
+#ifndef PIXELPULSE_ENTITYPOOL_H
+#define PIXELPULSE_ENTITYPOOL_H
+
+#include "IEntity.h"
+#include "../Platform/Pool.h"
+
+namespace PixelPulse::Game
+{
+    // Type-erased pool of entity instances, one per entity type and scene (see Prefab)
+    class IEntityPool
+    {
+    public:
+        virtual ~IEntityPool() = default;
+
+        virtual IEntity *create() = 0;
+        virtual void destroy(IEntity *entity) = 0;
+    };
+
+    template <typename EntityClass>
+    class EntityPool : public IEntityPool
+    {
+    public:
+        IEntity *create() override { return m_pool.create(); }
+        void destroy(IEntity *entity) override { m_pool.destroy(static_cast<EntityClass *>(entity)); }
+
+    private:
+        Platform::ObjectPool<EntityClass, Platform::Memory::MemoryTag::Scene> m_pool;
+    };
+}
+
+#endif
@@ -8,6 +8,12 @@
 #include "../../Assets/AssetRegistry.h"
 #include "../../Physics/PhysicsWorld.h"
 
+namespace PixelPulse::Game
+{
+    class ComponentRegistry;
+    struct Prefab;
+}
+
 namespace PixelPulse::Game::Events
 {
     struct AttachEventPayload
@@ -15,6 +21,8 @@ namespace PixelPulse::Game::Events
         Assets::AssetRegistry *assetRegistry;
         SDL_Renderer *renderer;
         Physics::PhysicsWorld *physicsWorld;
+        ComponentRegistry *components;
+        const Prefab *prefab; // Shared data of the entity's type, null for entities of no registered type
     };
 }
 
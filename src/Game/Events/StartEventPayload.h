@@ -8,6 +8,11 @@
 #include "../../Assets/AssetRegistry.h"
 #include "../../Physics/PhysicsWorld.h"
 
+namespace PixelPulse::Game
+{
+    class ComponentRegistry;
+}
+
 namespace PixelPulse::Game::Events
 {
     struct StartEventPayload
@@ -15,6 +20,7 @@ namespace PixelPulse::Game::Events
         Assets::AssetRegistry *assetRegistry;
         SDL_Renderer *renderer;
         Physics::PhysicsWorld *physicsWorld;
+        ComponentRegistry *components;
     };
 }
 
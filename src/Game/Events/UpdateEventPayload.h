@@ -7,6 +7,12 @@
 #include "../Input.h"
 #include "../../Physics/PhysicsWorld.h"
 
+namespace PixelPulse::Game
+{
+    class ComponentRegistry;
+    class SceneCommandBuffer;
+}
+
 namespace PixelPulse::Game::Events
 {
     struct UpdateEventPayload
@@ -14,6 +20,8 @@ namespace PixelPulse::Game::Events
         float deltaTime;
         Input *input;
         Physics::PhysicsWorld *physicsWorld;
+        ComponentRegistry *components;
+        SceneCommandBuffer *commands; // Buffer of the thread running the update
     };
 }
 
@@ -17,9 +17,14 @@ namespace PixelPulse::Physics
 namespace PixelPulse::Game
 {
     class SceneNode;
+    class IEntityPool;
 
     typedef const char *EntityID;
 
+    // Index of the entity's concrete type in the EntityLibrary
+    typedef std::uint32_t EntityTypeIndex;
+    constexpr EntityTypeIndex InvalidEntityTypeIndex = std::numeric_limits<EntityTypeIndex>::max();
+
     class IEntity
     {
     public:
@@ -55,6 +60,15 @@ namespace PixelPulse::Game
         }
 
         static EntityID getID() { return "UnknownEntity"; }
+
+        // Set by EntityLibrary::createEntity, entities constructed directly have no type index
+        EntityTypeIndex getTypeIndex() const { return m_typeIndex; }
+
+    private:
+        friend class EntityLibrary;
+
+        EntityTypeIndex m_typeIndex = InvalidEntityTypeIndex;
+        IEntityPool *m_pool = nullptr; // Where the instance came from, null if allocated with PP_NEW
     };
 }
 
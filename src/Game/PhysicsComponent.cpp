@@ -14,15 +14,7 @@ namespace PixelPulse::Game
 
     PhysicsComponent::~PhysicsComponent()
     {
-        for (auto* collider : m_colliders)
-        {
-            if (m_physicsWorld)
-            {
-                m_physicsWorld->removeCollider(collider);
-            }
-        }
-        m_colliders.clear();
-
+        // Removing the body also removes the colliders attached to it
         if (m_rigidBody && m_physicsWorld)
         {
             m_physicsWorld->removeRigidBody(m_rigidBody);
@@ -55,7 +47,6 @@ namespace PixelPulse::Game
         {
             collider->setOffset(offset);
             collider->setListener(this);
-            m_colliders.push_back(collider);
         }
         return collider;
     }
@@ -73,7 +64,6 @@ namespace PixelPulse::Game
         {
             collider->setOffset(offset);
             collider->setListener(this);
-            m_colliders.push_back(collider);
         }
         return collider;
     }
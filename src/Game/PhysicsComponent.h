@@ -48,7 +48,6 @@ namespace PixelPulse::Game
         IEntity* m_owner;
         Physics::RigidBody* m_rigidBody;
         Physics::PhysicsWorld* m_physicsWorld;
-        std::vector<Physics::Collider*> m_colliders;
     };
 }
 
@@ -0,0 +1,100 @@
+#include "Prefab.h"
+#include "EntityLibrary.h"
+#include "EntityPool.h"
+#include "Sprite.h"
+#include "../Assets/AssetRegistry.h"
+#include "../Assets/Image.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    PrefabCache::~PrefabCache()
+    {
+        clear();
+    }
+
+    const Prefab *PrefabCache::get(EntityTypeIndex typeIndex, Assets::AssetRegistry *assetRegistry, SDL_Renderer *renderer)
+    {
+        if (typeIndex == InvalidEntityTypeIndex)
+        {
+            return nullptr;
+        }
+
+        if (typeIndex < m_prefabs.size() && m_prefabs[typeIndex])
+        {
+            return m_prefabs[typeIndex];
+        }
+
+        return resolve(typeIndex, assetRegistry, renderer);
+    }
+
+    Prefab *PrefabCache::resolve(EntityTypeIndex typeIndex, Assets::AssetRegistry *assetRegistry, SDL_Renderer *renderer)
+    {
+        EntityLibrary &entityLibrary = EntityLibrary::getInstance();
+
+        const PrefabDefinition *definition = entityLibrary.getPrefabDefinition(typeIndex);
+        if (!definition)
+        {
+            Logger::error("PrefabCache: No entity type with index %u", typeIndex);
+            return nullptr;
+        }
+
+        Prefab *prefab = PP_NEW(Prefab);
+        prefab->definition = *definition;
+        prefab->image = nullptr;
+        prefab->sprite = nullptr;
+        prefab->pool = entityLibrary.createEntityPool(typeIndex);
+
+        if (definition->imagePath)
+        {
+            if (assetRegistry && renderer)
+            {
+                prefab->image = assetRegistry->make<Assets::Image>(Assets::AssetMakeRequest{definition->imagePath});
+                prefab->image->load();
+
+                prefab->sprite = PP_NEW(Sprite, prefab->image);
+                if (!prefab->sprite->init(renderer))
+                {
+                    Logger::error("PrefabCache: Failed to initialize the sprite of %s", definition->imagePath);
+                    PP_DELETE(prefab->sprite);
+                    prefab->sprite = nullptr;
+                }
+            }
+            else
+            {
+                Logger::error("PrefabCache: No asset registry or renderer to load %s", definition->imagePath);
+            }
+        }
+
+        if (typeIndex >= m_prefabs.size())
+        {
+            m_prefabs.resize(typeIndex + 1, nullptr);
+        }
+        m_prefabs[typeIndex] = prefab;
+
+        Logger::debug("PrefabCache: Resolved prefab for entity type %u", typeIndex);
+        return prefab;
+    }
+
+    void PrefabCache::clear()
+    {
+        for (Prefab *prefab : m_prefabs)
+        {
+            if (!prefab)
+            {
+                continue;
+            }
+
+            if (prefab->sprite)
+            {
+                PP_DELETE(prefab->sprite);
+            }
+            if (prefab->pool)
+            {
+                PP_DELETE(prefab->pool);
+            }
+            PP_DELETE(prefab);
+        }
+        m_prefabs.clear();
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef PIXELPULSE_PREFAB_H
+#define PIXELPULSE_PREFAB_H
+
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "../Math/Vector2.h"
+#include "IEntity.h"
+
+struct SDL_Renderer;
+
+namespace PixelPulse::Assets
+{
+    class AssetRegistry;
+    class Image;
+}
+
+namespace PixelPulse::Game
+{
+    class Sprite;
+    class IEntityPool;
+
+    // Immutable data shared by every instance of an entity type. Types describe it with
+    // static void definePrefab(Game::PrefabDefinition &definition).
+    struct PrefabDefinition
+    {
+        const char *imagePath = nullptr;                                      // Shared sprite, none if null
+        Math::Vector2<float> scale = Math::Vector2<float>(1.0f, 1.0f);        // Initial local scale of an instance
+        Math::Vector2<float> colliderSize = Math::Vector2<float>(0.0f, 0.0f); // Box collider, none if zero
+        bool isStatic = false;                                                // Instances never move once started, see SceneNode::setStatic
+        const char *renderLayer = nullptr;                                    // Name of the scene's render layer instances start on, layer 0 if null or unknown
+        std::int16_t zOrder = 0;                                              // Initial z of an instance within its layer
+    };
+
+    // An entity type resolved for one scene: the definition's assets are loaded and its sprite
+    // created once, and instances come from a pool. Instances receive it in the attach payload
+    // and must not delete the sprite.
+    struct Prefab
+    {
+        PrefabDefinition definition;
+        Assets::Image *image;
+        Sprite *sprite;
+        IEntityPool *pool;
+
+        bool hasCollider() const { return definition.colliderSize.x > 0.0f && definition.colliderSize.y > 0.0f; }
+    };
+
+    // The scene's prefabs, indexed by entity type and resolved on first use
+    class PrefabCache
+    {
+    public:
+        PrefabCache() = default;
+        PrefabCache(const PrefabCache &) = delete;
+        PrefabCache &operator=(const PrefabCache &) = delete;
+        ~PrefabCache();
+
+        // Null for entities of no registered type. Instances of the type must be gone before
+        // clear() or the cache's destruction, they live in the prefab's pool.
+        const Prefab *get(EntityTypeIndex typeIndex, Assets::AssetRegistry *assetRegistry, SDL_Renderer *renderer);
+
+        void clear();
+
+    private:
+        Prefab *resolve(EntityTypeIndex typeIndex, Assets::AssetRegistry *assetRegistry, SDL_Renderer *renderer);
+
+        Platform::Vector<Prefab *, Platform::Memory::MemoryTag::Scene> m_prefabs; // Null until resolved
+    };
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include "RenderCommand.h"
+
+namespace PixelPulse::Game
+{
+    void RenderCommandBuffer::clear()
+    {
+        m_commands.clear();
+        m_order.clear();
+        m_textures.clear();
+        m_blendModes.clear();
+        m_lastTexture = nullptr;
+        m_lastTextureSlot = 0;
+    }
+
+    void RenderCommandBuffer::add(SDL_Texture *texture, const SDL_FRect &destination, const SDL_FRect *source,
+                                  std::uint8_t layer, std::uint16_t depth, const SDL_FColor &tint, SDL_BlendMode blendMode)
+    {
+        if (!texture)
+        {
+            return;
+        }
+
+        std::uint32_t index = static_cast<std::uint32_t>(m_commands.size());
+        std::uint64_t key = makeSortKey(layer, depth, getBlendSlot(blendMode), getTextureSlot(texture), index);
+
+        m_commands.push_back(RenderCommand{key, texture, blendMode, destination, source, tint});
+        m_order.push_back(SortEntry{key, index});
+    }
+
+    std::uint32_t RenderCommandBuffer::getTextureSlot(SDL_Texture *texture)
+    {
+        // Consecutive commands mostly share a texture, especially with the atlas
+        if (texture == m_lastTexture)
+        {
+            return m_lastTextureSlot;
+        }
+
+        auto it = std::find(m_textures.begin(), m_textures.end(), texture);
+        if (it == m_textures.end())
+        {
+            m_textures.push_back(texture);
+            it = m_textures.end() - 1;
+        }
+
+        m_lastTexture = texture;
+        m_lastTextureSlot = static_cast<std::uint32_t>(it - m_textures.begin());
+        return m_lastTextureSlot;
+    }
+
+    std::uint32_t RenderCommandBuffer::getBlendSlot(SDL_BlendMode blendMode)
+    {
+        auto it = std::find(m_blendModes.begin(), m_blendModes.end(), blendMode);
+        if (it == m_blendModes.end())
+        {
+            m_blendModes.push_back(blendMode);
+            it = m_blendModes.end() - 1;
+        }
+
+        return static_cast<std::uint32_t>(it - m_blendModes.begin());
+    }
+
+    void RenderCommandBuffer::project(const ViewProjection &viewProjection)
+    {
+        const float scale = viewProjection.scale;
+        const float offsetX = viewProjection.offset.x;
+        const float offsetY = viewProjection.offset.y;
+
+        // Branch-free and contiguous, the compiler vectorizes it
+        RenderCommand *commands = m_commands.data();
+        std::size_t count = m_commands.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SDL_FRect &destination = commands[i].destination;
+            destination.x = destination.x * scale + offsetX;
+            destination.y = destination.y * scale + offsetY;
+            destination.w *= scale;
+            destination.h *= scale;
+        }
+    }
+
+    void RenderCommandBuffer::sort()
+    {
+        constexpr int DigitBits = 8;
+        constexpr std::size_t DigitCount = sizeof(std::uint64_t);
+        constexpr std::size_t RadixSize = std::size_t(1) << DigitBits;
+
+        std::size_t count = m_order.size();
+        if (count < 2)
+        {
+            return;
+        }
+
+        // Histograms of every byte in a single read of the keys
+        std::uint32_t histograms[DigitCount][RadixSize] = {};
+        for (const SortEntry &entry : m_order)
+        {
+            for (std::size_t digit = 0; digit < DigitCount; ++digit)
+            {
+                histograms[digit][(entry.key >> (digit * DigitBits)) & (RadixSize - 1)]++;
+            }
+        }
+
+        m_scratch.resize(count);
+        SortEntry *source = m_order.data();
+        SortEntry *destination = m_scratch.data();
+
+        for (std::size_t digit = 0; digit < DigitCount; ++digit)
+        {
+            std::uint32_t *histogram = histograms[digit];
+            int shift = static_cast<int>(digit * DigitBits);
+
+            // Every key has the same byte here, the pass would not move anything
+            if (histogram[(source[0].key >> shift) & (RadixSize - 1)] == count)
+            {
+                continue;
+            }
+
+            std::uint32_t offset = 0;
+            for (std::size_t bucket = 0; bucket < RadixSize; ++bucket)
+            {
+                std::uint32_t bucketCount = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketCount;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                destination[histogram[(source[i].key >> shift) & (RadixSize - 1)]++] = source[i];
+            }
+            std::swap(source, destination);
+        }
+
+        // An odd number of passes left the result in the scratch array
+        if (source != m_order.data())
+        {
+            m_order.swap(m_scratch);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#ifndef PIXELPULSE_RENDERCOMMAND_H
+#define PIXELPULSE_RENDERCOMMAND_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "Camera.h"
+
+namespace PixelPulse::Game
+{
+    // One textured quad. Commands are drawn in ascending sortKey order, see makeSortKey().
+    struct RenderCommand
+    {
+        std::uint64_t sortKey;
+        SDL_Texture *texture;
+        SDL_BlendMode blendMode;
+        SDL_FRect destination;   // In world units, in pixels after RenderCommandBuffer::project()
+        const SDL_FRect *source; // Normalized texture coordinates, read at submission since atlas regions move on repack
+        SDL_FColor tint;
+    };
+
+    // Draw order, most significant first: layer, depth within the layer, blend mode, texture,
+    // then submission order. Commands that only differ in texture and sequence are adjacent once
+    // sorted, so the backend draws them in one call.
+    struct RenderSortKey
+    {
+        static constexpr int SequenceBits = 24;
+        static constexpr int TextureBits = 12;
+        static constexpr int BlendBits = 4;
+        static constexpr int DepthBits = 16;
+        static constexpr int LayerBits = 8;
+
+        static constexpr int TextureShift = SequenceBits;
+        static constexpr int BlendShift = TextureShift + TextureBits;
+        static constexpr int DepthShift = BlendShift + BlendBits;
+        static constexpr int LayerShift = DepthShift + DepthBits;
+
+        static_assert(LayerShift + LayerBits == 64, "Sort key fields must fill 64 bits");
+    };
+
+    constexpr std::uint64_t makeSortKey(std::uint8_t layer, std::uint16_t depth, std::uint32_t blendSlot, std::uint32_t textureSlot, std::uint32_t sequence)
+    {
+        return (static_cast<std::uint64_t>(layer) << RenderSortKey::LayerShift) |
+               (static_cast<std::uint64_t>(depth) << RenderSortKey::DepthShift) |
+               (static_cast<std::uint64_t>(blendSlot & ((1u << RenderSortKey::BlendBits) - 1)) << RenderSortKey::BlendShift) |
+               (static_cast<std::uint64_t>(textureSlot & ((1u << RenderSortKey::TextureBits) - 1)) << RenderSortKey::TextureShift) |
+               static_cast<std::uint64_t>(sequence & ((1u << RenderSortKey::SequenceBits) - 1));
+    }
+
+    // The frame's render commands, filled by the scene's render extraction and consumed by the
+    // backend (SpriteBatch). Textures get a per-frame slot in order of first use, so the key
+    // groups them without hashing pointers. sort() is an LSD radix sort of (key, index) pairs
+    // that skips the byte passes where every key agrees, which for a single layer and depth is
+    // most of them. The arrays keep their capacity between frames, so a steady frame does not
+    // allocate.
+    class RenderCommandBuffer
+    {
+    public:
+        static constexpr SDL_FRect FullTexture = {0.0f, 0.0f, 1.0f, 1.0f};
+        static constexpr SDL_FColor White = {1.0f, 1.0f, 1.0f, 1.0f};
+
+        void clear();
+
+        // The source must stay valid until the commands are submitted, like a TextureCache region
+        void add(SDL_Texture *texture, const SDL_FRect &destination, const SDL_FRect *source = &FullTexture,
+                 std::uint8_t layer = 0, std::uint16_t depth = 0, const SDL_FColor &tint = White,
+                 SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+        // Orders the commands by key, call once after the last add() of the frame
+        void sort();
+
+        // Maps every destination from world units to pixels in one pass over the commands in
+        // storage order, so the camera costs a multiply-add per command and nothing per node
+        void project(const ViewProjection &viewProjection);
+
+        std::size_t size() const { return m_commands.size(); }
+        bool empty() const { return m_commands.empty(); }
+
+        // The i-th command in sorted order
+        const RenderCommand &operator[](std::size_t i) const { return m_commands[m_order[i].index]; }
+
+    private:
+        struct SortEntry
+        {
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+        std::uint32_t getTextureSlot(SDL_Texture *texture);
+        std::uint32_t getBlendSlot(SDL_BlendMode blendMode);
+
+        Platform::Vector<RenderCommand, Platform::Memory::MemoryTag::Scene> m_commands;
+        Platform::Vector<SortEntry, Platform::Memory::MemoryTag::Scene> m_order;
+        Platform::Vector<SortEntry, Platform::Memory::MemoryTag::Scene> m_scratch;
+        Platform::Vector<SDL_Texture *, Platform::Memory::MemoryTag::Scene> m_textures; // Index is the slot
+        Platform::Vector<SDL_BlendMode, Platform::Memory::MemoryTag::Scene> m_blendModes;
+        SDL_Texture *m_lastTexture = nullptr;
+        std::uint32_t m_lastTextureSlot = 0;
+    };
+}
+
+#endif
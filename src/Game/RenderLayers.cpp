@@ -0,0 +1,35 @@
+#include "RenderLayers.h"
+
+namespace PixelPulse::Game
+{
+    RenderLayers::RenderLayers()
+    {
+        clear();
+    }
+
+    void RenderLayers::clear()
+    {
+        std::fill(std::begin(m_names), std::end(m_names), InvalidTagHash);
+        std::fill(std::begin(m_ySorted), std::end(m_ySorted), false);
+    }
+
+    bool RenderLayers::find(const char *name, std::uint8_t &layer) const
+    {
+        TagHash hash = hashTag(name);
+        if (hash == InvalidTagHash)
+        {
+            return false;
+        }
+
+        for (std::uint32_t i = 0; i < Count; ++i)
+        {
+            if (m_names[i] == hash)
+            {
+                layer = static_cast<std::uint8_t>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifndef PIXELPULSE_RENDERLAYERS_H
+#define PIXELPULSE_RENDERLAYERS_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "Tag.h"
+
+namespace PixelPulse::Game
+{
+    // Draw order settings of a scene's render layers. Layers draw in ascending number. Within a
+    // layer, sprites draw in ascending z, or in a y-sorted layer by the bottom edge of their
+    // bounds, so in top-down content whatever stands lower on screen overlaps what stands behind
+    // it. Both become the depth field of the sort key (see makeSortKey), the scene graph itself
+    // is never reordered.
+    class RenderLayers
+    {
+    public:
+        static constexpr std::uint32_t Count = 256;
+
+        RenderLayers();
+
+        // Resets every layer to unnamed and z-sorted
+        void clear();
+
+        // Names the layer so scene files can refer to it
+        void setName(std::uint8_t layer, const char *name) { m_names[layer] = hashTag(name); }
+
+        // False if no layer has the name
+        bool find(const char *name, std::uint8_t &layer) const;
+
+        void setYSorted(std::uint8_t layer, bool ySorted) { m_ySorted[layer] = ySorted; }
+        bool isYSorted(std::uint8_t layer) const { return m_ySorted[layer]; }
+
+        // Y-sorted depths are the distance in world units from this line, one unit apart. The top
+        // of the view, sprites below it fit the 16 bits unless they are 65535 units away.
+        static float getYSortOrigin(const SDL_FRect *view) { return view ? view->y : -32768.0f; }
+
+        // Depth within the layer of a sprite covering bounds (in world units)
+        std::uint16_t getDepth(std::uint8_t layer, std::int16_t z, const SDL_FRect &bounds, float ySortOrigin) const
+        {
+            if (m_ySorted[layer])
+            {
+                // NaN and everything above the origin go to 0
+                float y = bounds.y + bounds.h - ySortOrigin;
+                return static_cast<std::uint16_t>(y > 0.0f ? std::min(y, 65535.0f) : 0.0f);
+            }
+
+            return static_cast<std::uint16_t>(static_cast<std::int32_t>(z) + 32768);
+        }
+
+    private:
+        TagHash m_names[Count];
+        bool m_ySorted[Count];
+    };
+}
+
+#endif
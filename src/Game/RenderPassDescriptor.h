@@ -5,12 +5,17 @@
 
 #include "Platform/Std.h"
 #include "Math/Vector2.h"
+#include "Camera.h"
 
 namespace PixelPulse::Game
 {
     struct RenderPassDescriptor
     {
         Math::Vector2<std::int32_t> windowSize;
+        const Camera *camera = nullptr;
+
+        // The camera's mapping for this window, computed once per frame by the one filling the descriptor
+        ViewProjection viewProjection;
     };
 }
 
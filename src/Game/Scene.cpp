@@ -4,13 +4,29 @@
 #include "../Utilities.h"
 #include "EntityLibrary.h"
 #include "SceneLoader.h"
+#include "Sprite.h"
+#include "ComponentSystems.h"
+#include "../Physics/RigidBody.h"
 
 namespace PixelPulse::Game
 {
-    Scene::Scene() : m_rootNode(nullptr)
+    Scene::Scene() : m_rootNode(nullptr),
+                     m_phaseListsVersion(std::numeric_limits<std::uint64_t>::max()),
+                     m_pendingSpawnHead(0),
+                     m_spawnBudget(DefaultSpawnBudget),
+                     m_cullingGridVersion(std::numeric_limits<std::uint64_t>::max()),
+                     m_cullingGridEnabled(true),
+                     m_viewportSize(0, 0),
+                     m_view{},
+                     m_hasView(false),
+                     m_ySortOrigin(0.0f),
+                     m_frontSnapshot(0),
+                     m_phaseTimings{},
+                     m_started(false)
     {
-        m_rootNode = PP_NEW(SceneNode);
+        m_rootNode = createNode();
         m_rootNode->setTag(PIXELPULSE_MAKE_ID_DERIVED("root"));
+        m_graph.insert(m_rootNode, nullptr);
 
         m_assetRegistry = nullptr;
         m_renderer = nullptr;
@@ -19,17 +35,29 @@ namespace PixelPulse::Game
 
     Scene::~Scene()
     {
-        if (m_rootNode)
+        // Children come after their parents, going back to front detaches the leaves first. Each
+        // entity is detached while its node is still in the graph, as in destroySubtree().
+        m_despawnNodes.clear();
+        for (std::uint32_t i = m_graph.size(); i > 0; --i)
         {
-            PP_DELETE(m_rootNode);
-            m_rootNode = nullptr;
+            SceneNode *node = m_graph.getNode(i - 1);
+            if (IEntity *entity = node->getEntity())
+            {
+                entity->onDetach(node);
+                node->setEntity(nullptr);
+                EntityLibrary::destroyEntity(entity);
+            }
+            m_despawnNodes.push_back(node);
         }
 
-        for (IEntity *entity : m_entities)
+        // The graph writes into its nodes when cleared, so the nodes go back to the pool after it
+        m_graph.clear();
+        for (SceneNode *node : m_despawnNodes)
         {
-            PP_DELETE(entity);
+            m_nodePool.destroy(node);
         }
-        m_entities.clear();
+        m_despawnNodes.clear();
+        m_rootNode = nullptr;
     }
 
     void Scene::start()
@@ -40,8 +68,18 @@ namespace PixelPulse::Game
             startEventPayload.assetRegistry = m_assetRegistry;
             startEventPayload.renderer = m_renderer;
             startEventPayload.physicsWorld = m_physicsWorld;
+            startEventPayload.components = &m_components;
+
+            for (std::uint32_t i = 0; i < m_graph.size(); ++i)
+            {
+                SceneNode *node = m_graph.getNode(i);
+                if (IEntity *entity = node->getEntity())
+                {
+                    entity->onStart(node, startEventPayload);
+                }
+            }
 
-            m_rootNode->start(startEventPayload);
+            m_started = true;
         }
         else
         {
@@ -53,16 +91,445 @@ namespace PixelPulse::Game
     {
         Events::UpdateEventPayload updatedPayload = payload;
         updatedPayload.physicsWorld = m_physicsWorld;
+        updatedPayload.components = &m_components;
+        updatedPayload.commands = &m_commandBuffers.local();
+
+        const float ticksToMilliseconds = 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+        std::uint64_t phaseStart = SDL_GetPerformanceCounter();
+        auto endPhase = [&](float &timing)
+        {
+            std::uint64_t now = SDL_GetPerformanceCounter();
+            timing = static_cast<float>(now - phaseStart) * ticksToMilliseconds;
+            phaseStart = now;
+        };
+
+        rebuildPhaseLists();
+        updateEntities(updatedPayload);
+
+        // The jobs have joined. Despawns and spawns stay queued for the next applyPendingChanges().
+        applyCommands();
+        endPhase(m_phaseTimings.entityUpdate);
+
+        syncPhysics();
+        endPhase(m_phaseTimings.physicsSync);
+
+        propagateTransforms();
+        endPhase(m_phaseTimings.transformPropagation);
+
+        extractRenderCommands();
+        endPhase(m_phaseTimings.renderExtraction);
+    }
+
+    void Scene::applyPendingChanges()
+    {
+        applyPendingDespawns();
+        applyPendingSpawns();
+    }
+
+    void Scene::rebuildPhaseLists()
+    {
+        if (m_phaseListsVersion == m_graph.getVersion())
+        {
+            return;
+        }
+
+        m_entityNodes.clear();
+        m_entityBatches.clear();
+        m_physicsNodes.clear();
+        m_spriteNodes.clear();
+        m_staticSpriteNodes.clear();
+
+        const EntityLibrary &entityLibrary = EntityLibrary::getInstance();
+
+        for (std::uint32_t i = 0; i < m_graph.size(); ++i)
+        {
+            SceneNode *node = m_graph.getNode(i);
+
+            // Types without an onUpdate override are left out of the update phase entirely
+            IEntity *entity = node->getEntity();
+            if (entity && entityLibrary.getUpdateBatchFunction(entity->getTypeIndex()))
+            {
+                m_entityNodes.push_back(node);
+            }
+            if (node->getRigidBody())
+            {
+                m_physicsNodes.push_back(node);
+            }
+            if (node->getSprite())
+            {
+                (node->isStatic() ? m_staticSpriteNodes : m_spriteNodes).push_back(node);
+            }
+        }
+
+        // Group instances of a type together, keeping depth-first order within each type
+        auto byTypeThenDepthFirst = [](const SceneNode *a, const SceneNode *b)
+        {
+            EntityTypeIndex typeA = a->getEntity()->getTypeIndex();
+            EntityTypeIndex typeB = b->getEntity()->getTypeIndex();
+            return typeA != typeB ? typeA < typeB : a->getIndex() < b->getIndex();
+        };
+        std::sort(m_entityNodes.begin(), m_entityNodes.end(), byTypeThenDepthFirst);
+
+        std::uint32_t count = static_cast<std::uint32_t>(m_entityNodes.size());
+        for (std::uint32_t first = 0; first < count;)
+        {
+            EntityTypeIndex typeIndex = m_entityNodes[first]->getEntity()->getTypeIndex();
+
+            std::uint32_t last = first + 1;
+            while (last < count && m_entityNodes[last]->getEntity()->getTypeIndex() == typeIndex)
+            {
+                last++;
+            }
+
+            EntityUpdateBatch batch;
+            batch.update = entityLibrary.getUpdateBatchFunction(typeIndex);
+            batch.first = first;
+            batch.count = last - first;
+            batch.parallel = entityLibrary.isUpdateThreadSafe(typeIndex);
+            m_entityBatches.push_back(batch);
+            first = last;
+        }
+
+        m_entityJobs.reserve(m_entityBatches.size());
+
+        m_phaseListsVersion = m_graph.getVersion();
+    }
+
+    static void runEntityUpdateJob(void *context, std::size_t begin, std::size_t end)
+    {
+        const EntityUpdateJob *job = static_cast<const EntityUpdateJob *>(context);
+
+        Events::UpdateEventPayload payload = *job->payload;
+        payload.commands = &job->commandBuffers->local();
+
+        job->update(std::span<SceneNode *const>(job->nodes + begin, end - begin), payload);
+    }
+
+    void Scene::updateEntities(const Events::UpdateEventPayload &payload)
+    {
+        // Small enough to balance across workers, large enough to amortize scheduling
+        constexpr std::size_t EntityUpdateGrainSize = 64;
+
+        Platform::JobSystem &jobSystem = Platform::JobSystem::getInstance();
+        Platform::JobCounter counter;
+
+        // Parallel batches go out first so workers run them while this thread does the rest.
+        // The lists are only rebuilt between phases, nodes attached here update from the next frame.
+        m_entityJobs.clear();
+        for (const EntityUpdateBatch &batch : m_entityBatches)
+        {
+            if (batch.parallel)
+            {
+                m_entityJobs.push_back(EntityUpdateJob{m_entityNodes.data() + batch.first, batch.update, &payload, &m_commandBuffers});
+                jobSystem.parallelFor(batch.count, EntityUpdateGrainSize, &runEntityUpdateJob, &m_entityJobs.back(), counter);
+            }
+        }
+
+        for (const EntityUpdateBatch &batch : m_entityBatches)
+        {
+            if (!batch.parallel)
+            {
+                batch.update(std::span<SceneNode *const>(m_entityNodes.data() + batch.first, batch.count), payload);
+            }
+        }
+
+        jobSystem.wait(counter);
+
+        Systems::integrateVelocities(m_components, payload.deltaTime);
+    }
+
+    void Scene::applyCommands()
+    {
+        // Thread order keeps replay deterministic for a given split of the work
+        for (std::size_t i = 0; i < m_commandBuffers.size(); ++i)
+        {
+            SceneCommandBuffer &buffer = m_commandBuffers[i];
+            for (const SceneCommand &command : buffer.getCommands())
+            {
+                switch (command.type)
+                {
+                case SceneCommandType::SpawnByID:
+                {
+                    Transform local;
+                    local.position = command.vector;
+                    requestSpawn(command.entityID, local);
+                    break;
+                }
+                case SceneCommandType::ApplyForce:
+                    command.body->applyForce(command.vector);
+                    break;
+                case SceneCommandType::ApplyImpulse:
+                    command.body->applyImpulse(command.vector);
+                    break;
+                case SceneCommandType::SetVelocity:
+                    command.body->setVelocity(command.vector);
+                    break;
+                case SceneCommandType::Despawn:
+                    despawn(command.node);
+                    break;
+                }
+            }
+            buffer.clear();
+        }
+    }
+
+    void Scene::requestSpawn(const char *entityID, const Transform &local)
+    {
+        if (!entityID)
+        {
+            Logger::error("Attempting to request a spawn with a null entity ID");
+            return;
+        }
+
+        m_pendingSpawns.push_back(PendingSpawn{entityID, local});
+    }
+
+    void Scene::applyPendingSpawns()
+    {
+        std::size_t pending = getPendingSpawnCount();
+        if (pending == 0)
+        {
+            return;
+        }
+
+        std::size_t count = (m_spawnBudget > 0) ? std::min<std::size_t>(pending, m_spawnBudget) : pending;
+
+        // Grow every container once for the whole batch instead of once per spawn
+        m_nodePool.reserve(count);
+        m_graph.reserve(m_graph.size() + static_cast<std::uint32_t>(count));
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // By value, onAttach may request more spawns and grow the queue
+            PendingSpawn spawn = m_pendingSpawns[m_pendingSpawnHead + i];
+            spawnByID(spawn.entityID, spawn.local);
+        }
+
+        m_pendingSpawnHead += count;
+        if (m_pendingSpawnHead == m_pendingSpawns.size())
+        {
+            m_pendingSpawns.clear();
+            m_pendingSpawnHead = 0;
+        }
+        else
+        {
+            Logger::debug("Scene: %zu spawns deferred to the next frame", getPendingSpawnCount());
+        }
+    }
+
+    void Scene::despawn(SceneNode *node)
+    {
+        if (!node)
+        {
+            Logger::error("Attempting to despawn a null node");
+            return;
+        }
+
+        if (node == m_rootNode || node->getGraph() != &m_graph)
+        {
+            Logger::error("Attempting to despawn a node that is not an entity of this scene");
+            return;
+        }
 
-        m_rootNode->update(updatedPayload, Math::Vector2<float>(0.0f, 0.0f), Math::Vector2<float>(1.0f, 1.0f));
+        m_pendingDespawns.push_back(node);
+    }
+
+    void Scene::applyPendingDespawns()
+    {
+        if (m_pendingDespawns.empty())
+        {
+            return;
+        }
+
+        // Despawns requested while these are torn down (e.g. from onDetach) wait for the next frame
+        std::swap(m_despawnBatch, m_pendingDespawns);
+
+        // Descendants come after their ancestors, so going from the highest index down removes
+        // them before their ancestor, and a removal only moves nodes with higher indices
+        auto byIndexDescending = [](const SceneNode *a, const SceneNode *b)
+        {
+            return a->getIndex() > b->getIndex();
+        };
+        std::sort(m_despawnBatch.begin(), m_despawnBatch.end(), byIndexDescending);
+
+        SceneNode *previous = nullptr;
+        for (SceneNode *node : m_despawnBatch)
+        {
+            if (node != previous)
+            {
+                destroySubtree(node);
+                previous = node;
+            }
+        }
+
+        m_despawnBatch.clear();
+    }
+
+    void Scene::destroySubtree(SceneNode *node)
+    {
+        std::uint32_t first = node->getIndex();
+        std::uint32_t end = first + m_graph.getSubtreeSize(first);
+
+        // Leaves first, each entity is detached while its node is still in the graph
+        m_despawnNodes.clear();
+        for (std::uint32_t i = end; i > first; --i)
+        {
+            SceneNode *subtreeNode = m_graph.getNode(i - 1);
+            if (IEntity *entity = subtreeNode->getEntity())
+            {
+                entity->onDetach(subtreeNode);
+                subtreeNode->setEntity(nullptr);
+                EntityLibrary::destroyEntity(entity);
+            }
+            m_despawnNodes.push_back(subtreeNode);
+        }
+
+        m_graph.remove(node);
+
+        for (SceneNode *subtreeNode : m_despawnNodes)
+        {
+            m_nodePool.destroy(subtreeNode);
+        }
+    }
+
+    void Scene::syncPhysics()
+    {
+        for (SceneNode *node : m_physicsNodes)
+        {
+            // Resting bodies leave their subtree clean
+            Math::Vector2<float> position = node->getRigidBody()->getPosition();
+            if (position != node->getPosition())
+            {
+                node->setPosition(position);
+            }
+        }
+
+        Systems::syncRigidBodies(m_components);
+        Systems::syncLinkedNodes(m_components);
+    }
+
+    void Scene::propagateTransforms()
+    {
+        m_graph.updateWorldTransforms();
+    }
+
+    void Scene::extractRenderCommands()
+    {
+        RenderSnapshot &snapshot = m_snapshots[m_frontSnapshot ^ 1];
+        snapshot.commands.clear();
+        snapshot.camera = m_camera;
+        snapshot.cullStats = SceneCullStats{};
+
+        m_hasView = m_viewportSize.x > 0 && m_viewportSize.y > 0;
+        if (m_hasView)
+        {
+            m_view = m_camera.getViewRect(m_viewportSize);
+        }
+        m_ySortOrigin = RenderLayers::getYSortOrigin(m_hasView ? &m_view : nullptr);
+
+        // Static sprites are mostly the background, first use also gives their textures the lower slots
+        extractStaticSprites(snapshot);
+
+        for (SceneNode *node : m_spriteNodes)
+        {
+            const Sprite *sprite = node->getSprite();
+            const Transform &transform = m_graph.getWorldTransform(node->getIndex());
+            SDL_FRect bounds = sprite->getWorldRect(transform.position, transform.scale);
+
+            if (m_hasView && !intersects(bounds, m_view))
+            {
+                snapshot.cullStats.culled++;
+                continue;
+            }
+
+            addSpriteCommand(snapshot, node, bounds);
+        }
+
+        snapshot.cullStats.culled += Systems::extractSprites(m_components, snapshot.commands, m_renderLayers, m_hasView ? &m_view : nullptr);
+        snapshot.cullStats.visible = static_cast<std::uint32_t>(snapshot.commands.size());
+    }
+
+    void Scene::extractStaticSprites(RenderSnapshot &snapshot)
+    {
+        if (!m_hasView || !m_cullingGridEnabled)
+        {
+            for (SceneNode *node : m_staticSpriteNodes)
+            {
+                const Sprite *sprite = node->getSprite();
+                const Transform &transform = m_graph.getWorldTransform(node->getIndex());
+                SDL_FRect bounds = sprite->getWorldRect(transform.position, transform.scale);
+
+                if (m_hasView && !intersects(bounds, m_view))
+                {
+                    snapshot.cullStats.culled++;
+                    continue;
+                }
+
+                addSpriteCommand(snapshot, node, bounds);
+            }
+            return;
+        }
+
+        // The phase lists were rebuilt for this version before propagation, so world transforms are current
+        if (m_cullingGridVersion != m_phaseListsVersion)
+        {
+            rebuildCullingGrid();
+        }
+
+        // Ascending indices keep depth-first order, sprites outside the queried cells are culled without a visit
+        m_cullingResults.clear();
+        m_cullingGrid.query(m_view, m_cullingResults);
+
+        std::uint32_t visible = 0;
+        for (std::uint32_t index : m_cullingResults)
+        {
+            const SDL_FRect &bounds = m_staticSpriteBounds[index];
+            if (intersects(bounds, m_view))
+            {
+                addSpriteCommand(snapshot, m_staticSpriteNodes[index], bounds);
+                visible++;
+            }
+        }
+
+        snapshot.cullStats.culled += static_cast<std::uint32_t>(m_staticSpriteNodes.size()) - visible;
+    }
+
+    void Scene::addSpriteCommand(RenderSnapshot &snapshot, const SceneNode *node, const SDL_FRect &bounds)
+    {
+        const Sprite *sprite = node->getSprite();
+        std::uint8_t layer = node->getRenderLayer();
+        std::uint16_t depth = m_renderLayers.getDepth(layer, node->getZOrder(), bounds, m_ySortOrigin);
+
+        snapshot.commands.add(sprite->getTexture(), bounds, &sprite->getSource(), layer, depth);
+    }
+
+    void Scene::rebuildCullingGrid()
+    {
+        m_staticSpriteBounds.clear();
+        for (SceneNode *node : m_staticSpriteNodes)
+        {
+            const Transform &transform = m_graph.getWorldTransform(node->getIndex());
+            m_staticSpriteBounds.push_back(node->getSprite()->getWorldRect(transform.position, transform.scale));
+        }
+
+        m_cullingGrid.build(m_staticSpriteBounds);
+        m_cullingGridVersion = m_phaseListsVersion;
     }
 
     void Scene::render(const Game::RenderPassDescriptor &renderPassDescriptor)
     {
-        m_rootNode->render(m_renderer, &renderPassDescriptor);
+        RenderCommandBuffer &commands = m_snapshots[m_frontSnapshot].commands;
+        commands.sort();
+        commands.project(renderPassDescriptor.viewProjection);
+        m_spriteBatch.submit(m_renderer, commands);
+    }
+
+    SceneNode *Scene::createNode()
+    {
+        return m_nodePool.create();
     }
 
-    void Scene::attach(SceneNode *node, SceneNode *parent)
+    void Scene::attach(SceneNode *node, SceneNode *parent, const Transform &local)
     {
         if (!node)
         {
@@ -74,21 +541,55 @@ namespace PixelPulse::Game
         attachEventPayload.assetRegistry = m_assetRegistry;
         attachEventPayload.renderer = m_renderer;
         attachEventPayload.physicsWorld = m_physicsWorld;
+        attachEventPayload.components = &m_components;
+        attachEventPayload.prefab = nullptr;
 
         SceneNode *target = (parent) ? parent : m_rootNode;
-        if (target)
+        if (!target)
         {
-            target->addChild(node);
-            node->getEntity()->onAttach(node, attachEventPayload);
+            Logger::error("Parent node is null, cannot attach node");
+            return;
         }
-        else
+
+        if (!m_graph.insert(node, target, local))
         {
-            Logger::error("Parent node is null, cannot attach node");
+            Logger::error("Failed to attach node to the scene graph");
             return;
         }
+
+        if (IEntity *entity = node->getEntity())
+        {
+            attachEventPayload.prefab = m_prefabs.get(entity->getTypeIndex(), m_assetRegistry, m_renderer);
+            if (attachEventPayload.prefab)
+            {
+                const PrefabDefinition &definition = attachEventPayload.prefab->definition;
+                node->setStatic(definition.isStatic);
+                node->setZOrder(definition.zOrder);
+
+                std::uint8_t layer = 0;
+                if (definition.renderLayer)
+                {
+                    m_renderLayers.find(definition.renderLayer, layer);
+                }
+                node->setRenderLayer(layer);
+            }
+            entity->onAttach(node, attachEventPayload);
+
+            // Nodes attached after start() are started right away
+            if (m_started)
+            {
+                Events::StartEventPayload startEventPayload;
+                startEventPayload.assetRegistry = m_assetRegistry;
+                startEventPayload.renderer = m_renderer;
+                startEventPayload.physicsWorld = m_physicsWorld;
+                startEventPayload.components = &m_components;
+
+                entity->onStart(node, startEventPayload);
+            }
+        }
     }
 
-    SceneNode *Scene::spawn(IEntity *entity)
+    SceneNode *Scene::spawn(IEntity *entity, const Transform &local)
     {
         if (!entity)
         {
@@ -96,17 +597,21 @@ namespace PixelPulse::Game
             return nullptr;
         }
 
-        SceneNode *node = PP_NEW(SceneNode);
-        node->setTag(PIXELPULSE_MAKE_ID());
-        node->setEntity(entity);
+        SceneNode *node = createNode();
+        if (!node)
+        {
+            Logger::error("Failed to allocate a scene node");
+            return nullptr;
+        }
 
-        m_entities.push_back(entity);
+        // Untagged, only tags set explicitly (e.g. from the scene file) are indexed
+        node->setEntity(entity);
 
-        attach(node);
+        attach(node, nullptr, local);
         return node;
     }
 
-    SceneNode *Scene::spawnByID(const char *entityID)
+    SceneNode *Scene::spawnByID(const char *entityID, const Transform &local)
     {
         if (!entityID)
         {
@@ -114,7 +619,11 @@ namespace PixelPulse::Game
             return nullptr;
         }
 
-        IEntity *entity = EntityLibrary::getInstance().createEntity(entityID);
+        // Instances come from the type's prefab pool, its assets are resolved on the first spawn
+        EntityLibrary &entityLibrary = EntityLibrary::getInstance();
+        EntityTypeIndex typeIndex = entityLibrary.findEntityType(entityID);
+        const Prefab *prefab = m_prefabs.get(typeIndex, m_assetRegistry, m_renderer);
+        IEntity *entity = entityLibrary.createEntity(typeIndex, prefab ? prefab->pool : nullptr);
 
         if (!entity)
         {
@@ -122,8 +631,8 @@ namespace PixelPulse::Game
             return nullptr;
         }
 
-        Logger::info("Spawning entity with ID: %s", entityID);
-        return spawn(entity);
+        Logger::debug("Spawning entity with ID: %s", entityID);
+        return spawn(entity, local);
     }
 
     bool Scene::loadFromJSON(const char *jsonFilePath)
@@ -5,7 +5,20 @@
 
 #include "RenderPassDescriptor.h"
 #include "SceneNode.h"
+#include "SceneGraph.h"
+#include "EntityLibrary.h"
+#include "ComponentRegistry.h"
+#include "RenderCommand.h"
+#include "SceneCommandBuffer.h"
+#include "Prefab.h"
+#include "SpriteBatch.h"
+#include "CullingGrid.h"
+#include "Camera.h"
+#include "RenderLayers.h"
+#include "../Platform/JobSystem.h"
+#include "../Platform/Pool.h"
 #include "../Platform/Std.h"
+#include "../Platform/Containers.h"
 
 struct SDL_Renderer;
 
@@ -22,10 +35,61 @@ namespace PixelPulse::Game
     }
 
     class SceneLoader;
+    class Sprite;
+
+    // Time spent in each phase of the last Scene::update, in milliseconds
+    struct ScenePhaseTimings
+    {
+        float entityUpdate;
+        float physicsSync;
+        float transformPropagation;
+        float renderExtraction;
+    };
+
+    // Sprites considered by a render extraction
+    struct SceneCullStats
+    {
+        std::uint32_t visible;
+        std::uint32_t culled;
+    };
+
+    // Everything render() needs from one update, so drawing never reads the scene itself
+    struct RenderSnapshot
+    {
+        RenderCommandBuffer commands;
+        Camera camera; // As of the extraction, the view the commands were culled against
+        SceneCullStats cullStats;
+    };
+
+    // A run of m_entityNodes holding instances of one entity type
+    struct EntityUpdateBatch
+    {
+        EntityUpdateBatchFunction update;
+        std::uint32_t first;
+        std::uint32_t count;
+        bool parallel; // The type is thread safe, the batch is split into jobs
+    };
+
+    // Context of the jobs of one parallel batch
+    struct EntityUpdateJob
+    {
+        SceneNode *const *nodes;
+        EntityUpdateBatchFunction update;
+        const Events::UpdateEventPayload *payload;
+        Platform::PerThread<SceneCommandBuffer, Platform::Memory::MemoryTag::Scene> *commandBuffers;
+    };
+
+    struct PendingSpawn
+    {
+        const char *entityID;
+        Transform local;
+    };
 
     class Scene
     {
     public:
+        static constexpr std::uint32_t DefaultSpawnBudget = 256;
+
         Scene();
         Scene(const Scene &) = delete;
         virtual ~Scene();
@@ -36,21 +100,150 @@ namespace PixelPulse::Game
         Physics::PhysicsWorld* getPhysicsWorld() const { return m_physicsWorld; }
 
         void start();
+
+        // Frame sync point: applies the despawns and spawns recorded by the last update, which
+        // may load assets and create textures. Main thread only, never while update() runs.
+        void applyPendingChanges();
+
+        // Runs the update phases in order: entity logic, physics sync, transform propagation and
+        // render extraction. Each phase iterates its own dense list. Extraction fills the back
+        // snapshot, and nothing here touches the renderer or the front snapshot, so the update
+        // can run on a worker while render() draws the previous frame.
         void update(const Events::UpdateEventPayload &payload);
+
+        // Hands the snapshot extracted by the last update over to render(). Call once that
+        // update has finished and no render is running.
+        void swapRenderSnapshots() { m_frontSnapshot ^= 1; }
+
+        // Window size in pixels, render extraction skips sprites outside of the camera's view of
+        // it. Nothing is culled until it is set.
+        void setViewportSize(const Math::Vector2<std::int32_t> &viewportSize) { m_viewportSize = viewportSize; }
+
+        // Entities may move the camera during the update, extraction uses where it ends up.
+        // The render stage reads getRenderCamera() instead, the camera of the front snapshot.
+        Camera &getCamera() { return m_camera; }
+        const Camera &getCamera() const { return m_camera; }
+        const Camera &getRenderCamera() const { return m_snapshots[m_frontSnapshot].camera; }
+
+        // Static sprites (see PrefabDefinition::isStatic) are looked up in a grid rather than
+        // tested one by one. The grid is rebuilt when nodes are added or removed.
+        void setCullingGridEnabled(bool enabled) { m_cullingGridEnabled = enabled; }
+
+        // Layer names and y-sort modes, set up by the scene file before its entities spawn
+        RenderLayers &getRenderLayers() { return m_renderLayers; }
+        const RenderLayers &getRenderLayers() const { return m_renderLayers; }
+
+        // Sorts the front snapshot's commands, projects them with the descriptor's view-projection
+        // and submits them through the sprite batch
         void render(const Game::RenderPassDescriptor &renderPassDescriptor);
 
-        void attach(SceneNode *node, SceneNode *parent = nullptr);
-        SceneNode *spawn(IEntity *entity);
-        SceneNode *spawnByID(const char *entityID);
+        // Nodes come from createNode() and are owned by the scene once attached, along with their
+        // entity. The local transform is in place before the entity's onAttach (and onStart, once
+        // started).
+        SceneNode *createNode();
+        void attach(SceneNode *node, SceneNode *parent = nullptr, const Transform &local = Transform());
+
+        // Immediate spawns, attaching runs onAttach which may load assets, avoid mid-update
+        SceneNode *spawn(IEntity *entity, const Transform &local = Transform());
+        SceneNode *spawnByID(const char *entityID, const Transform &local = Transform());
+
+        // Deferred spawn, applied at the next frame sync point within the spawn budget. The ID
+        // must stay valid until then (a literal or an entity's getID()). Not thread safe, jobs
+        // record spawns in payload.commands instead.
+        void requestSpawn(const char *entityID, const Transform &local = Transform());
+
+        // Maximum number of deferred spawns applied per frame, larger waves spread over several
+        // frames in request order. 0 removes the limit.
+        void setSpawnBudget(std::uint32_t spawnsPerFrame) { m_spawnBudget = spawnsPerFrame; }
+        std::size_t getPendingSpawnCount() const { return m_pendingSpawns.size() - m_pendingSpawnHead; }
+
+        // Deferred removal of the node and its subtree, applied at the next frame sync point
+        // before the pending spawns, so the node stays valid for the rest of the frame. Each
+        // entity is detached and deleted (taking its sprite, components and physics body with it)
+        // and the nodes go back to the pool. Despawning a node twice, or a node and one of its
+        // ancestors, in the same frame is fine. Not thread safe, jobs use payload.commands.
+        void despawn(SceneNode *node);
+        std::size_t getPendingDespawnCount() const { return m_pendingDespawns.size(); }
 
         bool loadFromJSON(const char* jsonFilePath);
 
+        // Tag lookups go through the graph's hash index, see Tag.h. The span is valid until a
+        // node with the tag is attached, despawned or retagged.
+        SceneNode *findByTag(const char *tag) const { return m_graph.findByTag(hashTag(tag)); }
+        SceneNode *findByTag(TagHash tag) const { return m_graph.findByTag(tag); }
+        std::span<SceneNode *const> findAllByTag(const char *tag) const { return m_graph.getTagGroup(hashTag(tag)); }
+        std::span<SceneNode *const> findAllByTag(TagHash tag) const { return m_graph.getTagGroup(tag); }
+
+        const SceneGraph &getGraph() const { return m_graph; }
+        ComponentRegistry &getComponents() { return m_components; }
+        const ScenePhaseTimings &getPhaseTimings() const { return m_phaseTimings; }
+        const SpriteBatchStats &getRenderStats() const { return m_spriteBatch.getStats(); }
+        const SceneCullStats &getCullStats() const { return m_snapshots[m_frontSnapshot].cullStats; }
+
     private:
+        void rebuildPhaseLists();
+        void applyCommands();
+        void applyPendingSpawns();
+        void applyPendingDespawns();
+        void destroySubtree(SceneNode *node);
+
+        void updateEntities(const Events::UpdateEventPayload &payload);
+        void syncPhysics();
+        void propagateTransforms();
+        void extractRenderCommands();
+        void extractStaticSprites(RenderSnapshot &snapshot);
+        void addSpriteCommand(RenderSnapshot &snapshot, const SceneNode *node, const SDL_FRect &bounds);
+        void rebuildCullingGrid();
+
         SDL_Renderer *m_renderer;
         Assets::AssetRegistry *m_assetRegistry;
         Physics::PhysicsWorld *m_physicsWorld;
+        Platform::ObjectPool<SceneNode, Platform::Memory::MemoryTag::Scene> m_nodePool;
+        SceneGraph m_graph;
+        ComponentRegistry m_components;
+        PrefabCache m_prefabs;
         SceneNode *m_rootNode;
-        std::vector<IEntity *> m_entities;
+
+        // Dense per-phase lists in depth-first order, rebuilt when the graph version changes
+        std::uint64_t m_phaseListsVersion;
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_entityNodes; // Grouped by entity type
+        Platform::Vector<EntityUpdateBatch, Platform::Memory::MemoryTag::Scene> m_entityBatches;
+        Platform::Vector<EntityUpdateJob, Platform::Memory::MemoryTag::Scene> m_entityJobs;
+        Platform::PerThread<SceneCommandBuffer, Platform::Memory::MemoryTag::Scene> m_commandBuffers;
+
+        // FIFO of deferred spawns, entries before the head have been applied
+        Platform::Vector<PendingSpawn, Platform::Memory::MemoryTag::Scene> m_pendingSpawns;
+        std::size_t m_pendingSpawnHead;
+        std::uint32_t m_spawnBudget;
+
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_pendingDespawns;
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_despawnBatch;
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_despawnNodes;
+
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_physicsNodes;
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_spriteNodes;
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_staticSpriteNodes;
+
+        // Bounds of m_staticSpriteNodes as of the last grid build, static nodes do not move
+        CullingGrid m_cullingGrid;
+        Platform::Vector<SDL_FRect, Platform::Memory::MemoryTag::Scene> m_staticSpriteBounds;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_cullingResults;
+        std::uint64_t m_cullingGridVersion;
+        bool m_cullingGridEnabled;
+
+        Camera m_camera;
+        Math::Vector2<std::int32_t> m_viewportSize;
+        SDL_FRect m_view; // The camera's view as of the last extraction
+        bool m_hasView;
+        RenderLayers m_renderLayers;
+        float m_ySortOrigin; // As of the last extraction, see RenderLayers::getYSortOrigin
+
+        // Double buffered, update() extracts into the back one while render() draws the front one
+        RenderSnapshot m_snapshots[2];
+        std::uint32_t m_frontSnapshot;
+        SpriteBatch m_spriteBatch;
+        ScenePhaseTimings m_phaseTimings;
+        bool m_started;
     };
 }
 
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef PIXELPULSE_SCENECOMMANDBUFFER_H
+#define PIXELPULSE_SCENECOMMANDBUFFER_H
+
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "../Math/Vector2.h"
+
+namespace PixelPulse::Physics
+{
+    class RigidBody;
+}
+
+namespace PixelPulse::Game
+{
+    class SceneNode;
+
+    enum class SceneCommandType : std::uint8_t
+    {
+        SpawnByID,    // Spawn entityID at vector
+        ApplyForce,   // Apply vector as a force to body
+        ApplyImpulse, // Apply vector as an impulse to body
+        SetVelocity,  // Set the velocity of body to vector
+        Despawn       // Despawn node and its subtree
+    };
+
+    struct SceneCommand
+    {
+        SceneCommandType type;
+        const char *entityID; // Must outlive the frame, e.g. a string literal or Entity::getID()
+        Physics::RigidBody *body;
+        SceneNode *node;
+        Math::Vector2<float> vector;
+    };
+
+    // Records writes to shared scene and physics state so entity updates running as jobs never
+    // touch it directly. The scene keeps one buffer per job system thread and replays them in
+    // thread order on the main thread once the entity update phase has joined.
+    class SceneCommandBuffer
+    {
+    public:
+        void spawnByID(const char *entityID, const Math::Vector2<float> &position)
+        {
+            m_commands.push_back(SceneCommand{SceneCommandType::SpawnByID, entityID, nullptr, nullptr, position});
+        }
+
+        void applyForce(Physics::RigidBody *body, const Math::Vector2<float> &force)
+        {
+            m_commands.push_back(SceneCommand{SceneCommandType::ApplyForce, nullptr, body, nullptr, force});
+        }
+
+        void applyImpulse(Physics::RigidBody *body, const Math::Vector2<float> &impulse)
+        {
+            m_commands.push_back(SceneCommand{SceneCommandType::ApplyImpulse, nullptr, body, nullptr, impulse});
+        }
+
+        void setVelocity(Physics::RigidBody *body, const Math::Vector2<float> &velocity)
+        {
+            m_commands.push_back(SceneCommand{SceneCommandType::SetVelocity, nullptr, body, nullptr, velocity});
+        }
+
+        void despawn(SceneNode *node)
+        {
+            m_commands.push_back(SceneCommand{SceneCommandType::Despawn, nullptr, nullptr, node, Math::Vector2<float>()});
+        }
+
+        const Platform::Vector<SceneCommand, Platform::Memory::MemoryTag::Scene> &getCommands() const { return m_commands; }
+        bool empty() const { return m_commands.empty(); }
+
+        // Keeps the capacity, so steady-state recording does not allocate
+        void clear() { m_commands.clear(); }
+
+    private:
+        Platform::Vector<SceneCommand, Platform::Memory::MemoryTag::Scene> m_commands;
+    };
+}
+
+#endif
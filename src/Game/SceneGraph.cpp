@@ -0,0 +1,288 @@
+#include "SceneGraph.h"
+#include "SceneNode.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    Transform SceneGraph::combine(const Transform &parent, const Transform &local)
+    {
+        // The local offset is in the parent's space, so it is scaled and rotated with the parent
+        Math::Vector2<float> offset = parent.scale * local.position;
+        if (parent.rotation != 0.0f)
+        {
+            offset = offset.rotate(parent.rotation);
+        }
+
+        Transform world;
+        world.position = parent.position + offset;
+        world.scale = parent.scale * local.scale;
+        world.rotation = parent.rotation + local.rotation;
+        return world;
+    }
+
+    bool SceneGraph::insert(SceneNode *node, SceneNode *parent, const Transform &local)
+    {
+        if (!node)
+        {
+            Logger::error("SceneGraph::insert: Node is null");
+            return false;
+        }
+
+        if (node->m_graph)
+        {
+            Logger::error("SceneGraph::insert: Node is already part of a scene graph");
+            return false;
+        }
+
+        if (parent && parent->m_graph != this)
+        {
+            Logger::error("SceneGraph::insert: Parent node is not part of this scene graph");
+            return false;
+        }
+
+        std::uint32_t parentIndex = parent ? parent->m_index : InvalidIndex;
+        std::uint32_t index = parent ? parentIndex + m_subtreeSizes[parentIndex] : size();
+
+        // If the parent is dirty the new node inherits that so it is recomputed with it
+        Transform world = parent ? combine(m_worldTransforms[parentIndex], local) : local;
+        std::uint8_t dirty = parent ? m_dirty[parentIndex] : 0;
+
+        m_nodes.insert(m_nodes.begin() + index, node);
+        m_parents.insert(m_parents.begin() + index, parentIndex);
+        m_subtreeSizes.insert(m_subtreeSizes.begin() + index, 1);
+        m_localTransforms.insert(m_localTransforms.begin() + index, local);
+        m_worldTransforms.insert(m_worldTransforms.begin() + index, world);
+        m_dirty.insert(m_dirty.begin() + index, dirty);
+
+        node->m_graph = this;
+        node->m_index = index;
+        addToTagGroup(node);
+
+        // Everything after the insertion point moved down by one
+        for (std::uint32_t i = index + 1; i < size(); ++i)
+        {
+            if (m_parents[i] != InvalidIndex && m_parents[i] >= index)
+            {
+                m_parents[i]++;
+            }
+            m_nodes[i]->m_index = i;
+        }
+
+        for (std::uint32_t ancestor = parentIndex; ancestor != InvalidIndex; ancestor = m_parents[ancestor])
+        {
+            m_subtreeSizes[ancestor]++;
+        }
+
+        invalidate();
+
+        return true;
+    }
+
+    bool SceneGraph::remove(SceneNode *node)
+    {
+        if (!node || node->m_graph != this)
+        {
+            Logger::error("SceneGraph::remove: Node is not part of this scene graph");
+            return false;
+        }
+
+        std::uint32_t index = node->m_index;
+        std::uint32_t count = m_subtreeSizes[index];
+        std::uint32_t parentIndex = m_parents[index];
+        std::uint32_t last = size() - 1;
+
+        for (std::uint32_t i = index; i < index + count; ++i)
+        {
+            removeFromTagGroup(m_nodes[i], m_nodes[i]->m_tagHash);
+            m_nodes[i]->m_graph = nullptr;
+            m_nodes[i]->m_index = InvalidIndex;
+        }
+
+        for (std::uint32_t ancestor = parentIndex; ancestor != InvalidIndex; ancestor = m_parents[ancestor])
+        {
+            m_subtreeSizes[ancestor] -= count;
+        }
+
+        // Siblings may come in any order, so the last node can fill the hole if it is a leaf
+        // sibling, which it is when the parent's subtree ends at the end of the arrays
+        bool swapWithLast = count == 1 &&
+                            index != last &&
+                            m_parents[last] == parentIndex &&
+                            m_subtreeSizes[last] == 1;
+
+        if (index == last || swapWithLast)
+        {
+            if (swapWithLast)
+            {
+                m_nodes[index] = m_nodes[last];
+                m_subtreeSizes[index] = 1;
+                m_localTransforms[index] = m_localTransforms[last];
+                m_worldTransforms[index] = m_worldTransforms[last];
+                m_dirty[index] = m_dirty[last];
+                m_nodes[index]->m_index = index;
+            }
+
+            m_nodes.pop_back();
+            m_parents.pop_back();
+            m_subtreeSizes.pop_back();
+            m_localTransforms.pop_back();
+            m_worldTransforms.pop_back();
+            m_dirty.pop_back();
+        }
+        else
+        {
+            m_nodes.erase(m_nodes.begin() + index, m_nodes.begin() + index + count);
+            m_parents.erase(m_parents.begin() + index, m_parents.begin() + index + count);
+            m_subtreeSizes.erase(m_subtreeSizes.begin() + index, m_subtreeSizes.begin() + index + count);
+            m_localTransforms.erase(m_localTransforms.begin() + index, m_localTransforms.begin() + index + count);
+            m_worldTransforms.erase(m_worldTransforms.begin() + index, m_worldTransforms.begin() + index + count);
+            m_dirty.erase(m_dirty.begin() + index, m_dirty.begin() + index + count);
+
+            // Everything after the removed range moved up by count
+            for (std::uint32_t i = index; i < size(); ++i)
+            {
+                if (m_parents[i] != InvalidIndex && m_parents[i] >= index)
+                {
+                    m_parents[i] -= count;
+                }
+                m_nodes[i]->m_index = i;
+            }
+        }
+
+        invalidate();
+
+        return true;
+    }
+
+    void SceneGraph::clear()
+    {
+        for (SceneNode *node : m_nodes)
+        {
+            node->m_graph = nullptr;
+            node->m_index = InvalidIndex;
+        }
+
+        m_nodes.clear();
+        m_parents.clear();
+        m_subtreeSizes.clear();
+        m_localTransforms.clear();
+        m_worldTransforms.clear();
+        m_dirty.clear();
+        m_tagGroups.clear();
+        m_hasDirty = false;
+        invalidate();
+    }
+
+    SceneNode *SceneGraph::findByTag(TagHash tag) const
+    {
+        auto it = m_tagGroups.find(tag);
+        return it != m_tagGroups.end() ? it->second.front() : nullptr;
+    }
+
+    std::span<SceneNode *const> SceneGraph::getTagGroup(TagHash tag) const
+    {
+        auto it = m_tagGroups.find(tag);
+        if (it == m_tagGroups.end())
+        {
+            return std::span<SceneNode *const>();
+        }
+
+        return std::span<SceneNode *const>(it->second.data(), it->second.size());
+    }
+
+    void SceneGraph::onTagChanged(SceneNode *node, TagHash previousTag)
+    {
+        if (!node || node->m_graph != this)
+        {
+            return;
+        }
+
+        removeFromTagGroup(node, previousTag);
+        addToTagGroup(node);
+    }
+
+    void SceneGraph::addToTagGroup(SceneNode *node)
+    {
+        if (node->m_tagHash == InvalidTagHash)
+        {
+            return;
+        }
+
+        auto &group = m_tagGroups[node->m_tagHash];
+        node->m_tagSlot = static_cast<std::uint32_t>(group.size());
+        group.push_back(node);
+    }
+
+    void SceneGraph::removeFromTagGroup(SceneNode *node, TagHash tag)
+    {
+        auto it = m_tagGroups.find(tag);
+        if (it == m_tagGroups.end())
+        {
+            return;
+        }
+
+        // Swap with the last member, groups are unordered
+        auto &group = it->second;
+        SceneNode *last = group.back();
+        group[node->m_tagSlot] = last;
+        last->m_tagSlot = node->m_tagSlot;
+        group.pop_back();
+
+        // Empty groups are kept, a tag whose nodes come and go does not reallocate its group
+    }
+
+    void SceneGraph::reserve(std::uint32_t count)
+    {
+        m_nodes.reserve(count);
+        m_parents.reserve(count);
+        m_subtreeSizes.reserve(count);
+        m_localTransforms.reserve(count);
+        m_worldTransforms.reserve(count);
+        m_dirty.reserve(count);
+    }
+
+    void SceneGraph::markDirty(std::uint32_t index)
+    {
+        // Descendants of a dirty node are already dirty
+        if (m_dirty[index])
+        {
+            return;
+        }
+
+        std::uint32_t end = index + m_subtreeSizes[index];
+        std::fill(m_dirty.begin() + index, m_dirty.begin() + end, std::uint8_t(1));
+        m_hasDirty.store(true, std::memory_order_relaxed);
+    }
+
+    void SceneGraph::updateWorldTransforms()
+    {
+        if (!m_hasDirty)
+        {
+            return;
+        }
+
+        // Parents precede their children, so one forward pass sees every parent already updated
+        std::uint32_t count = size();
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            if (!m_dirty[i])
+            {
+                continue;
+            }
+
+            m_dirty[i] = 0;
+
+            std::uint32_t parentIndex = m_parents[i];
+            if (parentIndex == InvalidIndex)
+            {
+                m_worldTransforms[i] = m_localTransforms[i];
+            }
+            else
+            {
+                m_worldTransforms[i] = combine(m_worldTransforms[parentIndex], m_localTransforms[i]);
+            }
+        }
+
+        m_hasDirty = false;
+    }
+}
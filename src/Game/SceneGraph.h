@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef PIXELPULSE_SCENEGRAPH_H
+#define PIXELPULSE_SCENEGRAPH_H
+
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "../Math/Vector2.h"
+#include "Tag.h"
+
+namespace PixelPulse::Game
+{
+    class SceneNode;
+
+    struct Transform
+    {
+        Math::Vector2<float> position;
+        Math::Vector2<float> scale = Math::Vector2<float>(1.0f, 1.0f);
+        float rotation = 0.0f; // In degrees
+    };
+
+    // Flattened scene hierarchy. Nodes are stored in depth-first order in parallel arrays, so a
+    // parent always comes before its children and a subtree is a contiguous range starting at its
+    // root. World transforms are propagated in a single forward pass and traversals are linear
+    // scans. SceneNode objects are stable handles into the arrays, their index is kept up to date
+    // when insertions shift the arrays.
+    //
+    // World transforms are cached. Editing a local transform marks the node and its subtree (a
+    // contiguous range) dirty, and updateWorldTransforms() only recomputes dirty nodes. A dirty
+    // node's descendants are always dirty too, so a node never combines with a stale parent.
+    //
+    // Nodes are also indexed by tag hash. Every tag has a group of the nodes carrying it, kept up
+    // to date on insert, remove and SceneNode::setTag. Nodes know their slot in their group, so
+    // each of those is O(1).
+    class SceneGraph
+    {
+    public:
+        static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+        SceneGraph() = default;
+        SceneGraph(const SceneGraph &) = delete;
+        SceneGraph &operator=(const SceneGraph &) = delete;
+
+        // Inserts the node as the last child of parent, or as a new root if parent is null
+        bool insert(SceneNode *node, SceneNode *parent, const Transform &local = Transform());
+
+        // Removes the node and its subtree, the nodes themselves are not deleted. A leaf is swapped
+        // with the last node when that is a leaf sibling (the common case of flat entities under the
+        // scene root), which is O(depth). Otherwise the nodes after the subtree shift up.
+        bool remove(SceneNode *node);
+
+        // Detaches all nodes from the graph, the nodes themselves are not deleted
+        void clear();
+
+        // Grows the arrays once ahead of a batch of insertions
+        void reserve(std::uint32_t count);
+
+        // Recomputes the world transform of dirty nodes, does nothing if no node is dirty
+        void updateWorldTransforms();
+
+        // Marks the node and everything below it for world transform recomputation
+        void markDirty(std::uint32_t index);
+        bool isDirty(std::uint32_t index) const { return m_dirty[index] != 0; }
+
+        // Bumped whenever nodes are added or removed, or a node's entity, sprite or rigid body
+        // changes, so users can tell when lists derived from the graph must be rebuilt
+        std::uint64_t getVersion() const { return m_version; }
+        void invalidate() { m_version++; }
+
+        std::uint32_t size() const { return static_cast<std::uint32_t>(m_nodes.size()); }
+
+        SceneNode *getNode(std::uint32_t index) const { return m_nodes[index]; }
+        std::uint32_t getParentIndex(std::uint32_t index) const { return m_parents[index]; }
+        std::uint32_t getSubtreeSize(std::uint32_t index) const { return m_subtreeSizes[index]; }
+
+        const Transform &getLocalTransform(std::uint32_t index) const { return m_localTransforms[index]; }
+
+        // Mutable access to a local transform, marks the node dirty
+        Transform &editLocalTransform(std::uint32_t index)
+        {
+            markDirty(index);
+            return m_localTransforms[index];
+        }
+
+        const Transform &getWorldTransform(std::uint32_t index) const { return m_worldTransforms[index]; }
+
+        // Any one node with the tag, or null
+        SceneNode *findByTag(TagHash tag) const;
+
+        // All nodes with the tag, in no particular order. Valid until a node with the tag is
+        // inserted, removed or retagged.
+        std::span<SceneNode *const> getTagGroup(TagHash tag) const;
+
+        // Called by SceneNode::setTag to move the node from its previous tag's group
+        void onTagChanged(SceneNode *node, TagHash previousTag);
+
+    private:
+        static Transform combine(const Transform &parent, const Transform &local);
+
+        void addToTagGroup(SceneNode *node);
+        void removeFromTagGroup(SceneNode *node, TagHash tag);
+
+        Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene> m_nodes;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_parents;
+        Platform::Vector<std::uint32_t, Platform::Memory::MemoryTag::Scene> m_subtreeSizes; // Including the node itself
+        Platform::Vector<Transform, Platform::Memory::MemoryTag::Scene> m_localTransforms;
+        Platform::Vector<Transform, Platform::Memory::MemoryTag::Scene> m_worldTransforms;
+        Platform::Vector<std::uint8_t, Platform::Memory::MemoryTag::Scene> m_dirty;
+        Platform::UnorderedMap<TagHash, Platform::Vector<SceneNode *, Platform::Memory::MemoryTag::Scene>, Platform::Memory::MemoryTag::Scene> m_tagGroups;
+        std::atomic<bool> m_hasDirty = false; // Set from thread-safe entity updates running as jobs
+        std::uint64_t m_version = 0;
+    };
+}
+
+#endif
@@ -44,6 +44,12 @@ namespace PixelPulse::Game
 
             json sceneJson = json::parse(jsonStr);
 
+            // Layers first, entities refer to them by name
+            if (sceneJson.contains("layers") && sceneJson["layers"].is_array())
+            {
+                parseLayers(scene, sceneJson["layers"].dump());
+            }
+
             if (sceneJson.contains("entities") && sceneJson["entities"].is_array())
             {
                 for (const auto &entityJson : sceneJson["entities"])
@@ -103,6 +109,47 @@ namespace PixelPulse::Game
         }
     }
 
+    bool SceneLoader::parseLayers(Scene *scene, const std::string &layersJson)
+    {
+        try
+        {
+            json layers = json::parse(layersJson);
+
+            RenderLayers &renderLayers = scene->getRenderLayers();
+            renderLayers.clear();
+
+            // Layers draw in the order they are listed
+            if (layers.size() > RenderLayers::Count)
+            {
+                Logger::warning("SceneLoader: Only the first %u of %zu layers are used", RenderLayers::Count, layers.size());
+            }
+
+            std::uint32_t count = std::min(static_cast<std::uint32_t>(layers.size()), RenderLayers::Count);
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                const json &layerJson = layers[i];
+                std::uint8_t layer = static_cast<std::uint8_t>(i);
+
+                if (layerJson.contains("name") && layerJson["name"].is_string())
+                {
+                    renderLayers.setName(layer, layerJson["name"].get<std::string>().c_str());
+                }
+
+                if (layerJson.contains("ySort") && layerJson["ySort"].is_boolean())
+                {
+                    renderLayers.setYSorted(layer, layerJson["ySort"].get<bool>());
+                }
+            }
+
+            return true;
+        }
+        catch (const json::parse_error &e)
+        {
+            Logger::error("SceneLoader: JSON parse error in layers: %s", e.what());
+            return false;
+        }
+    }
+
     SceneNode *SceneLoader::parseEntity(Scene *scene, const std::string &entityJson)
     {
         try
@@ -127,20 +174,57 @@ namespace PixelPulse::Game
             if (entity.contains("position") && entity["position"].is_object() &&
                 entity["position"].contains("x") && entity["position"].contains("y"))
             {
-                node->m_position.x = entity["position"]["x"].get<float>();
-                node->m_position.y = entity["position"]["y"].get<float>();
+                node->setPosition(Math::Vector2<float>(entity["position"]["x"].get<float>(),
+                                                       entity["position"]["y"].get<float>()));
             }
 
             if (entity.contains("scale") && entity["scale"].is_object() &&
                 entity["scale"].contains("x") && entity["scale"].contains("y"))
             {
-                node->m_scale.x = entity["scale"]["x"].get<float>();
-                node->m_scale.y = entity["scale"]["y"].get<float>();
+                node->setScale(Math::Vector2<float>(entity["scale"]["x"].get<float>(),
+                                                    entity["scale"]["y"].get<float>()));
             }
 
             if (entity.contains("rotation") && entity["rotation"].is_number())
             {
-                node->m_rotation = entity["rotation"].get<float>();
+                node->setRotation(entity["rotation"].get<float>());
+            }
+
+            // Overrides the prefab's layer, by name or number
+            if (entity.contains("layer"))
+            {
+                const json &layerJson = entity["layer"];
+                std::uint8_t layer = 0;
+
+                if (layerJson.is_string())
+                {
+                    std::string layerName = layerJson.get<std::string>();
+                    if (scene->getRenderLayers().find(layerName.c_str(), layer))
+                    {
+                        node->setRenderLayer(layer);
+                    }
+                    else
+                    {
+                        Logger::warning("SceneLoader: Unknown layer '%s' for entity of type: %s", layerName.c_str(), entityType.c_str());
+                    }
+                }
+                else if (layerJson.is_number_integer() && layerJson.get<std::int64_t>() >= 0 &&
+                         layerJson.get<std::int64_t>() < static_cast<std::int64_t>(RenderLayers::Count))
+                {
+                    node->setRenderLayer(static_cast<std::uint8_t>(layerJson.get<std::int64_t>()));
+                }
+                else
+                {
+                    Logger::warning("SceneLoader: Invalid layer for entity of type: %s", entityType.c_str());
+                }
+            }
+
+            if (entity.contains("z") && entity["z"].is_number_integer())
+            {
+                std::int64_t z = std::clamp<std::int64_t>(entity["z"].get<std::int64_t>(),
+                                                          std::numeric_limits<std::int16_t>::min(),
+                                                          std::numeric_limits<std::int16_t>::max());
+                node->setZOrder(static_cast<std::int16_t>(z));
             }
 
             if (entity.contains("tag") && entity["tag"].is_string())
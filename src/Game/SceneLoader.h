@@ -17,6 +17,7 @@ namespace PixelPulse::Game
         bool loadScene(Scene *scene, const char *jsonFilePath);
 
     private:
+        bool parseLayers(Scene *scene, const std::string &layersJson);
         bool parseEntities(Scene *scene, const std::string &entitiesJson);
         SceneNode *parseEntity(Scene *scene, const std::string &entityJson);
     };
@@ -1,18 +1,21 @@
 
 #include "SceneNode.h"
-#include "Sprite.h"
 #include "../Platform/Platform.h"
 #include "../Utilities.h"
 
 namespace PixelPulse::Game
 {
-    SceneNode::SceneNode() : m_position(0.0f, 0.0f),
-                             m_scale(1.0f, 1.0f),
-                             m_rotation(0.0f),
-                             m_sprite(nullptr),
+    SceneNode::SceneNode() : m_sprite(nullptr),
                              m_entity(nullptr),
-                             m_parent(nullptr),
-                             m_tag(nullptr)
+                             m_rigidBody(nullptr),
+                             m_tag(nullptr),
+                             m_tagHash(InvalidTagHash),
+                             m_static(false),
+                             m_renderLayer(0),
+                             m_zOrder(0),
+                             m_graph(nullptr),
+                             m_index(SceneGraph::InvalidIndex),
+                             m_tagSlot(0)
     {
     }
 
@@ -24,12 +27,6 @@ namespace PixelPulse::Game
             m_entity = nullptr;
         }
 
-        for (SceneNode *child : m_children)
-        {
-            PP_DELETE(child);
-        }
-        m_children.clear();
-
         PIXELPULSE_FREE_ID(m_tag);
     }
 
@@ -37,67 +34,60 @@ namespace PixelPulse::Game
     {
         PIXELPULSE_FREE_ID(m_tag);
 
+        TagHash previousTag = m_tagHash;
         m_tag = tag;
+        m_tagHash = hashTag(tag);
+
+        if (m_graph && m_tagHash != previousTag)
+        {
+            m_graph->onTagChanged(this, previousTag);
+        }
     }
 
     void SceneNode::setSprite(Sprite *sprite)
     {
         m_sprite = sprite;
-    }
-
-    void SceneNode::setEntity(IEntity *entity)
-    {
-        m_entity = entity;
-    }
-
-    void SceneNode::start(const Events::StartEventPayload &payload)
-    {
-        if (m_entity)
-        {
-            m_entity->onStart(this, payload);
-        }
-
-        for (SceneNode *child : m_children)
+        if (m_graph)
         {
-            child->start(payload);
+            m_graph->invalidate();
         }
     }
 
-    void SceneNode::update(const Events::UpdateEventPayload &payload, const Math::Vector2<float> &parentPosition, const Math::Vector2<float> &parentScale)
+    void SceneNode::setStatic(bool isStatic)
     {
-        Math::Vector2<float> globalPosition = parentPosition + m_position;
-        Math::Vector2<float> globalScale = parentScale * m_scale;
-
-        if (m_entity)
-        {
-            m_entity->onUpdate(this, payload);
-        }
-
-        for (SceneNode *child : m_children)
+        m_static = isStatic;
+        if (m_graph)
         {
-            child->update(payload, globalPosition, globalScale);
+            m_graph->invalidate();
         }
     }
 
-    void SceneNode::render(::SDL_Renderer *renderer, const RenderPassDescriptor *renderPassDescriptor)
+    void SceneNode::setEntity(IEntity *entity)
     {
-        if (m_sprite)
+        m_entity = entity;
+        if (m_graph)
         {
-            m_sprite->render(renderer, renderPassDescriptor, m_position, m_scale);
+            m_graph->invalidate();
         }
+    }
 
-        for (const auto &child : m_children)
+    void SceneNode::setRigidBody(Physics::RigidBody *rigidBody)
+    {
+        m_rigidBody = rigidBody;
+        if (m_graph)
         {
-            child->render(renderer, renderPassDescriptor);
+            m_graph->invalidate();
         }
     }
 
-    void SceneNode::addChild(SceneNode *child)
+    SceneNode *SceneNode::getParent() const
     {
-        if (child)
+        if (!m_graph)
         {
-            child->m_parent = this;
-            m_children.push_back(child);
+            return nullptr;
         }
+
+        std::uint32_t parentIndex = m_graph->getParentIndex(m_index);
+        return parentIndex != SceneGraph::InvalidIndex ? m_graph->getNode(parentIndex) : nullptr;
     }
 }
@@ -5,61 +5,91 @@
 
 #include "../Platform/Std.h"
 #include "../Math/Vector2.h"
-#include "Events/UpdateEventPayload.h"
-#include "Events/StartEventPayload.h"
+#include "SceneGraph.h"
 #include "IEntity.h"
 
-struct SDL_Renderer;
+namespace PixelPulse::Physics
+{
+    class RigidBody;
+}
 
 namespace PixelPulse::Game
 {
     class Sprite;
-    struct RenderPassDescriptor;
 
+    // Handle to a node of a SceneGraph. The transform lives in the graph's arrays, so the
+    // transform accessors are only valid while the node is attached to a scene.
     class SceneNode
     {
     public:
-        Math::Vector2<float> m_position;
-        Math::Vector2<float> m_scale;
-        float m_rotation; // In degrees
-
         SceneNode();
         virtual ~SceneNode();
 
-        void addChild(SceneNode *child);
-
         void setSprite(Sprite *sprite);
         Sprite *getSprite() const { return m_sprite; }
 
         void setEntity(IEntity *entity);
         IEntity *getEntity() const { return m_entity; }
 
+        // Static nodes never move once attached, their sprite is culled through the scene's grid
+        void setStatic(bool isStatic);
+        bool isStatic() const { return m_static; }
+
+        // Draw order of the node's sprite, see RenderLayers. Read at every render extraction.
+        void setRenderLayer(std::uint8_t layer) { m_renderLayer = layer; }
+        std::uint8_t getRenderLayer() const { return m_renderLayer; }
+        void setZOrder(std::int16_t z) { m_zOrder = z; }
+        std::int16_t getZOrder() const { return m_zOrder; }
+
+        // The node's position follows this body during the scene's physics sync phase
+        void setRigidBody(Physics::RigidBody *rigidBody);
+        Physics::RigidBody *getRigidBody() const { return m_rigidBody; }
+
+        // Takes ownership of the tag string. Not thread safe while attached, the graph's tag
+        // index is updated.
         void setTag(const char *tag);
-        const char *getTag() const { return m_tag; }
+        const char *getTag() const { return m_tag; } // Null if untagged
+        TagHash getTagHash() const { return m_tagHash; }
+        bool hasTag(TagHash tag) const { return m_tagHash == tag; }
 
-        void start(const Events::StartEventPayload &payload);
-        void update(const Events::UpdateEventPayload &payload, const Math::Vector2<float> &parentPosition, const Math::Vector2<float> &parentScale);
-        void render(::SDL_Renderer *renderer, const Game::RenderPassDescriptor *renderPassDescriptor);
+        SceneGraph *getGraph() const { return m_graph; }
+        std::uint32_t getIndex() const { return m_index; }
+        SceneNode *getParent() const;
 
-    private:
-        Sprite *m_sprite;
-        IEntity *m_entity;
-        SceneNode *m_parent;
-        const char *m_tag;
+        const Math::Vector2<float> &getPosition() const { return m_graph->getLocalTransform(m_index).position; }
+        void setPosition(const Math::Vector2<float> &position) { m_graph->editLocalTransform(m_index).position = position; }
+        void translate(const Math::Vector2<float> &delta) { m_graph->editLocalTransform(m_index).position += delta; }
 
-        Math::Vector2<float> m_worldPosition;
-        Math::Vector2<float> m_worldScale;
+        const Math::Vector2<float> &getScale() const { return m_graph->getLocalTransform(m_index).scale; }
+        void setScale(const Math::Vector2<float> &scale) { m_graph->editLocalTransform(m_index).scale = scale; }
 
-    public:
-        std::vector<SceneNode *> m_children;
+        float getRotation() const { return m_graph->getLocalTransform(m_index).rotation; }
+        void setRotation(float rotation) { m_graph->editLocalTransform(m_index).rotation = rotation; }
 
-        // Prevent copying
+        // Cached world values, setters take effect at the next SceneGraph::updateWorldTransforms()
+        const Math::Vector2<float> &getWorldPosition() const { return m_graph->getWorldTransform(m_index).position; }
+        const Math::Vector2<float> &getWorldScale() const { return m_graph->getWorldTransform(m_index).scale; }
+        float getWorldRotation() const { return m_graph->getWorldTransform(m_index).rotation; }
+
+        // Prevent copying and moving, the graph refers to nodes by address
         SceneNode(const SceneNode &) = delete;
         SceneNode &operator=(const SceneNode &) = delete;
 
-        // Allow moving
-        SceneNode(SceneNode &&) = default;
-        SceneNode &operator=(SceneNode &&) = default;
+    private:
+        friend class SceneGraph;
+
+        Sprite *m_sprite;
+        IEntity *m_entity;
+        Physics::RigidBody *m_rigidBody;
+        const char *m_tag;
+        TagHash m_tagHash;
+        bool m_static;
+        std::uint8_t m_renderLayer;
+        std::int16_t m_zOrder;
+
+        SceneGraph *m_graph;
+        std::uint32_t m_index;
+        std::uint32_t m_tagSlot; // Position in the graph's group for m_tagHash
     };
 }
 
@@ -1,85 +1,74 @@
 #include "Sprite.h"
+#include "TextureCache.h"
 #include "../Logger.h"
 
 namespace PixelPulse::Game
 {
     Sprite::Sprite(Assets::Image *image)
         : m_image(image),
-          m_texture(nullptr),
+          m_region(nullptr),
           m_originalSize(0, 0)
     {
     }
 
     Sprite::~Sprite()
     {
-        if (m_texture)
-        {
-            SDL_DestroyTexture(m_texture);
-            m_texture = nullptr;
-        }
-
-        if (m_image)
+        // The cache holds the image reference, the texture goes with the last sprite using it
+        if (m_region)
         {
             Logger::debug("Sprite is releasing image '%s' (%s)", m_image->getName(), m_image->getId());
-            m_image->release();
-            m_image = nullptr;
+            TextureCache::getInstance().release(m_image);
+            m_region = nullptr;
         }
+
+        m_image = nullptr;
     }
 
     bool Sprite::init(SDL_Renderer *renderer)
     {
-        if (!m_image || !m_image->data)
+        if (!m_image || !m_image->isLoaded())
         {
             Logger::error("Image data is null");
             return false;
         }
 
-        m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, m_image->width, m_image->height);
-        if (!m_texture)
+        if (m_region)
         {
-            Logger::error("Failed to create texture: %s", SDL_GetError());
-            return false;
+            return true;
         }
 
-        m_image->retain();
+        m_region = TextureCache::getInstance().acquire(renderer, m_image);
+        if (!m_region)
+        {
+            return false;
+        }
 
         m_originalSize.x = m_image->width;
         m_originalSize.y = m_image->height;
-
-        SDL_UpdateTexture(m_texture, nullptr, m_image->data, m_image->width * 4);
         return true;
     }
 
-    float Sprite::getScalingFactor(int windowWidth, int windowHeight) const
+    SDL_FRect Sprite::getDestination(const RenderPassDescriptor *renderPassDescriptor, const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale) const
     {
-        // TODO: Remove hardcoded values
-        // These should be replaced with actual window dimensions
+        return renderPassDescriptor->viewProjection.apply(getWorldRect(worldPosition, worldScale));
+    }
 
-        float widthRatio = static_cast<float>(windowWidth) / 1280.0f;
-        float heightRatio = static_cast<float>(windowHeight) / 720.0f;
-        return std::min(widthRatio, heightRatio);
+    SDL_FRect Sprite::getWorldRect(const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale) const
+    {
+        SDL_FRect rect;
+        rect.x = worldPosition.x;
+        rect.y = worldPosition.y;
+        rect.w = static_cast<float>(m_originalSize.x) * worldScale.x;
+        rect.h = static_cast<float>(m_originalSize.y) * worldScale.y;
+        return rect;
     }
 
     void Sprite::render(SDL_Renderer *renderer, const RenderPassDescriptor *renderPassDescriptor, const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale)
     {
-        if (m_texture)
+        if (m_region)
         {
-            float scaleFactor = getScalingFactor(renderPassDescriptor->windowSize.x, renderPassDescriptor->windowSize.y);
-
-            float scaledWidth = static_cast<float>(m_originalSize.x) * scaleFactor * worldScale.x;
-            float scaledHeight = static_cast<float>(m_originalSize.y) * scaleFactor * worldScale.y;
-
-            float scaledX = worldPosition.x * scaleFactor;
-            float scaledY = worldPosition.y * scaleFactor;
-
-            SDL_FRect dstRect;
-            dstRect.x = scaledX;
-            dstRect.y = scaledY;
-            dstRect.w = scaledWidth;
-            dstRect.h = scaledHeight;
-
-            SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
-            SDL_RenderTexture(renderer, m_texture, nullptr, &dstRect);
+            SDL_FRect dstRect = getDestination(renderPassDescriptor, worldPosition, worldScale);
+            SDL_RenderTexture(renderer, m_region->texture, &m_region->rect, &dstRect);
         }
     }
 }
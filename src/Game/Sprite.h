@@ -9,6 +9,8 @@
 #include "../Game/RenderPassDescriptor.h"
 #include "../Math/Vector2.h"
 #include "Events/UpdateEventPayload.h"
+#include "TextureAtlas.h"
+#include "RenderCommand.h"
 
 namespace PixelPulse::Game
 {
@@ -18,7 +20,7 @@ namespace PixelPulse::Game
     {
     private:
         Assets::Image *m_image;
-        SDL_Texture *m_texture;
+        const TextureRegion *m_region; // Shared through the TextureCache, may move within the atlas
         Math::Vector2<std::int32_t> m_originalSize;
 
     public:
@@ -27,7 +29,16 @@ namespace PixelPulse::Game
 
         bool init(SDL_Renderer *renderer);
         void render(SDL_Renderer *renderer, const RenderPassDescriptor *renderPassDescriptor, const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale);
-        float getScalingFactor(int windowWidth, int windowHeight) const;
+        // Rectangle covered by the sprite at the given world position and scale, in world units
+        SDL_FRect getWorldRect(const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale) const;
+
+        // Screen rectangle covered by the sprite at the given world position and scale, through the descriptor's view-projection
+        SDL_FRect getDestination(const RenderPassDescriptor *renderPassDescriptor, const Math::Vector2<float> &worldPosition, const Math::Vector2<float> &worldScale) const;
+
+        SDL_Texture *getTexture() const { return m_region ? m_region->texture : nullptr; }
+
+        // Normalized sub-rectangle of getTexture() holding the image
+        const SDL_FRect &getSource() const { return m_region ? m_region->source : RenderCommandBuffer::FullTexture; }
     };
 }
 
@@ -0,0 +1,71 @@
+#include "SpriteBatch.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    void SpriteBatch::submit(SDL_Renderer *renderer, const RenderCommandBuffer &commands)
+    {
+        m_stats = SpriteBatchStats{};
+        m_stats.sprites = static_cast<std::uint32_t>(commands.size());
+
+        if (commands.empty())
+        {
+            return;
+        }
+
+        // Four corners per quad, clockwise from the top left
+        m_vertices.resize(commands.size() * 4);
+        for (std::size_t i = 0; i < commands.size(); ++i)
+        {
+            const RenderCommand &command = commands[i];
+            const SDL_FRect &source = *command.source;
+            const SDL_FColor &tint = command.tint;
+
+            float left = command.destination.x;
+            float top = command.destination.y;
+            float right = left + command.destination.w;
+            float bottom = top + command.destination.h;
+            SDL_Vertex *vertex = &m_vertices[i * 4];
+
+            vertex[0] = SDL_Vertex{{left, top}, tint, {source.x, source.y}};
+            vertex[1] = SDL_Vertex{{right, top}, tint, {source.x + source.w, source.y}};
+            vertex[2] = SDL_Vertex{{right, bottom}, tint, {source.x + source.w, source.y + source.h}};
+            vertex[3] = SDL_Vertex{{left, bottom}, tint, {source.x, source.y + source.h}};
+        }
+
+        std::size_t first = 0;
+        while (first < commands.size())
+        {
+            SDL_Texture *texture = commands[first].texture;
+            SDL_BlendMode blendMode = commands[first].blendMode;
+
+            std::size_t last = first + 1;
+            while (last < commands.size() && commands[last].texture == texture && commands[last].blendMode == blendMode)
+            {
+                last++;
+            }
+
+            // Indices are relative to the run's first vertex, so the array only grows with the longest run
+            std::size_t quadCount = last - first;
+            for (std::size_t quad = m_indices.size() / 6; quad < quadCount; ++quad)
+            {
+                int base = static_cast<int>(quad * 4);
+                m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+            }
+
+            int vertexCount = static_cast<int>(quadCount * 4);
+            int indexCount = static_cast<int>(quadCount * 6);
+
+            SDL_SetTextureBlendMode(texture, blendMode);
+            if (!SDL_RenderGeometry(renderer, texture, &m_vertices[first * 4], vertexCount, m_indices.data(), indexCount))
+            {
+                Logger::error("SpriteBatch: Failed to render geometry: %s", SDL_GetError());
+            }
+
+            m_stats.drawCalls++;
+            m_stats.vertices += static_cast<std::uint32_t>(vertexCount);
+            m_stats.indices += static_cast<std::uint32_t>(indexCount);
+            first = last;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#ifndef PIXELPULSE_SPRITEBATCH_H
+#define PIXELPULSE_SPRITEBATCH_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "RenderCommand.h"
+
+namespace PixelPulse::Game
+{
+    // Counters of the last SpriteBatch::submit
+    struct SpriteBatchStats
+    {
+        std::uint32_t sprites;
+        std::uint32_t drawCalls;
+        std::uint32_t vertices;
+        std::uint32_t indices;
+    };
+
+    // Render backend: walks a sorted RenderCommandBuffer and draws it with one SDL_RenderGeometry
+    // call per run of commands sharing a texture and blend mode. The vertex and index arrays keep
+    // their capacity between frames, so a steady frame does not allocate.
+    class SpriteBatch
+    {
+    public:
+        // The commands must be sorted and projected to pixels
+        void submit(SDL_Renderer *renderer, const RenderCommandBuffer &commands);
+
+        const SpriteBatchStats &getStats() const { return m_stats; }
+
+    private:
+        Platform::Vector<SDL_Vertex, Platform::Memory::MemoryTag::Scene> m_vertices;
+        Platform::Vector<int, Platform::Memory::MemoryTag::Scene> m_indices; // Relative to a run's first vertex, shared by all runs
+        SpriteBatchStats m_stats = {};
+    };
+}
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#ifndef PIXELPULSE_TAG_H
+#define PIXELPULSE_TAG_H
+
+#include "../Platform/Std.h"
+
+namespace PixelPulse::Game
+{
+    // Tags are interned to a 64-bit FNV-1a hash, so lookups and comparisons are integer
+    // operations. Two tags with the same hash are treated as the same tag.
+    typedef std::uint64_t TagHash;
+    constexpr TagHash InvalidTagHash = 0; // Untagged
+
+    // constexpr, so literal tags hash at compile time
+    constexpr TagHash hashTag(const char *tag)
+    {
+        if (!tag)
+        {
+            return InvalidTagHash;
+        }
+
+        TagHash hash = 14695981039346656037ull;
+        for (; *tag; ++tag)
+        {
+            hash ^= static_cast<unsigned char>(*tag);
+            hash *= 1099511628211ull;
+        }
+
+        // Keep 0 free for untagged nodes
+        return hash != InvalidTagHash ? hash : 1;
+    }
+}
+
+#endif
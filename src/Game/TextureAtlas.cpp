@@ -0,0 +1,300 @@
+#include "TextureAtlas.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    // Source of the transparent gutters, large enough for the longest side of an atlased image
+    static const std::uint8_t s_transparentPixels[TextureAtlas::MaxPageSize * TextureAtlas::Padding * 4] = {};
+
+    TextureAtlas::~TextureAtlas()
+    {
+        clear();
+    }
+
+    bool TextureAtlas::insert(SDL_Renderer *renderer, Assets::Image *image, TextureRegion *region)
+    {
+        if (!image || !image->data || !region)
+        {
+            return false;
+        }
+
+        if (m_pageSize == 0)
+        {
+            std::int64_t maxTextureSize = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+            m_pageSize = (maxTextureSize > 0) ? static_cast<int>(std::min<std::int64_t>(maxTextureSize, MaxPageSize)) : MaxPageSize;
+            if (m_pageSize < MinPageSize)
+            {
+                Logger::warning("TextureAtlas: Maximum texture size %d is too small for atlas pages", m_pageSize);
+                m_pageSize = -1;
+            }
+            else
+            {
+                Logger::debug("TextureAtlas: %dx%d pages", m_pageSize, m_pageSize);
+            }
+        }
+
+        if (m_pageSize < 0 || image->width > getMaxImageSize() || image->height > getMaxImageSize())
+        {
+            return false;
+        }
+
+        for (Page *page : m_pages)
+        {
+            if (pack(page, image, region))
+            {
+                return true;
+            }
+        }
+
+        // Reclaim what removals left behind before growing
+        for (Page *page : m_pages)
+        {
+            if (page->freedArea > 0 && repack(page, image, region))
+            {
+                return true;
+            }
+        }
+
+        if (m_pages.size() >= MaxPages)
+        {
+            return false;
+        }
+
+        Page *page = createPage(renderer);
+        return page && pack(page, image, region);
+    }
+
+    bool TextureAtlas::insertBaked(SDL_Renderer *renderer, const Assets::Atlas &atlas, const Assets::AtlasEntry &entry, TextureRegion *region)
+    {
+        if (!region || entry.page >= atlas.getPageCount())
+        {
+            return false;
+        }
+
+        auto it = std::find_if(m_bakedPages.begin(), m_bakedPages.end(), [&](const BakedPage &page)
+                               { return page.atlas == &atlas && page.index == entry.page; });
+
+        const Assets::AtlasPage &atlasPage = atlas.getPage(entry.page);
+        if (it == m_bakedPages.end())
+        {
+            SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, atlasPage.width, atlasPage.height);
+            if (!texture)
+            {
+                Logger::error("TextureAtlas: Failed to create baked page %u (%dx%d) of %s: %s", entry.page, atlasPage.width, atlasPage.height, atlas.getPath(), SDL_GetError());
+                return false;
+            }
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            SDL_UpdateTexture(texture, nullptr, atlasPage.pixels, atlasPage.width * 4);
+
+            m_bakedPages.push_back(BakedPage{&atlas, entry.page, texture, 0});
+            it = m_bakedPages.end() - 1;
+
+            Logger::debug("TextureAtlas: Uploaded baked page %u (%dx%d) of %s", entry.page, atlasPage.width, atlasPage.height, atlas.getPath());
+        }
+
+        it->regionCount++;
+
+        const float pageWidth = static_cast<float>(atlasPage.width);
+        const float pageHeight = static_cast<float>(atlasPage.height);
+        region->texture = it->texture;
+        region->rect = SDL_FRect{static_cast<float>(entry.x), static_cast<float>(entry.y), static_cast<float>(entry.width), static_cast<float>(entry.height)};
+        region->source = SDL_FRect{region->rect.x / pageWidth, region->rect.y / pageHeight, region->rect.w / pageWidth, region->rect.h / pageHeight};
+        return true;
+    }
+
+    void TextureAtlas::remove(TextureRegion *region)
+    {
+        if (!region)
+        {
+            return;
+        }
+
+        auto baked = std::find_if(m_bakedPages.begin(), m_bakedPages.end(), [region](const BakedPage &page)
+                                  { return page.texture == region->texture; });
+        if (baked != m_bakedPages.end())
+        {
+            if (--baked->regionCount == 0)
+            {
+                SDL_DestroyTexture(baked->texture);
+                *baked = m_bakedPages.back();
+                m_bakedPages.pop_back();
+            }
+            region->texture = nullptr;
+            return;
+        }
+
+        Page *page = findPage(m_pages, region->texture);
+        if (!page)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < page->placements.size(); ++i)
+        {
+            if (page->placements[i].region == region)
+            {
+                page->placements[i] = page->placements.back();
+                page->placements.pop_back();
+                page->freedArea += static_cast<std::int64_t>(region->rect.w + 2 * Padding) * static_cast<std::int64_t>(region->rect.h + 2 * Padding);
+                break;
+            }
+        }
+
+        // An empty page is free again as a whole
+        if (page->placements.empty())
+        {
+            resetPage(page);
+        }
+
+        region->texture = nullptr;
+    }
+
+    void TextureAtlas::clear()
+    {
+        for (Page *page : m_pages)
+        {
+            SDL_DestroyTexture(page->texture);
+            PP_DELETE(page);
+        }
+
+        for (const BakedPage &page : m_bakedPages)
+        {
+            SDL_DestroyTexture(page.texture);
+        }
+
+        // Swapped out rather than cleared so their capacity goes too
+        decltype(m_pages)().swap(m_pages);
+        decltype(m_bakedPages)().swap(m_bakedPages);
+        decltype(m_rects)().swap(m_rects);
+        decltype(m_trialNodes)().swap(m_trialNodes);
+        m_pageSize = 0; // The next renderer may allow a different size
+    }
+
+    TextureAtlas::Page *TextureAtlas::createPage(SDL_Renderer *renderer)
+    {
+        SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, m_pageSize, m_pageSize);
+        if (!texture)
+        {
+            Logger::error("TextureAtlas: Failed to create a page: %s", SDL_GetError());
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        Page *page = PP_NEW(Page);
+        page->texture = texture;
+        page->nodes.resize(static_cast<std::size_t>(m_pageSize));
+        resetPage(page);
+        m_pages.push_back(page);
+
+        Logger::debug("TextureAtlas: Created page %zu", m_pages.size());
+        return page;
+    }
+
+    void TextureAtlas::resetPage(Page *page) const
+    {
+        stbrp_init_target(&page->context, m_pageSize, m_pageSize, page->nodes.data(), static_cast<int>(page->nodes.size()));
+        page->freedArea = 0;
+    }
+
+    TextureAtlas::Page *TextureAtlas::findPage(const Platform::Vector<Page *, Platform::Memory::MemoryTag::Static> &pages, SDL_Texture *texture)
+    {
+        for (Page *page : pages)
+        {
+            if (page->texture == texture)
+            {
+                return page;
+            }
+        }
+        return nullptr;
+    }
+
+    bool TextureAtlas::pack(Page *page, Assets::Image *image, TextureRegion *region)
+    {
+        stbrp_rect rect = {};
+        rect.w = image->width + 2 * Padding;
+        rect.h = image->height + 2 * Padding;
+
+        stbrp_pack_rects(&page->context, &rect, 1);
+        if (!rect.was_packed)
+        {
+            return false;
+        }
+
+        upload(page, image, region, rect.x, rect.y);
+        page->placements.push_back(Placement{image, region});
+        return true;
+    }
+
+    bool TextureAtlas::repack(Page *page, Assets::Image *image, TextureRegion *region)
+    {
+        // The live images plus the new one, the new one last
+        m_rects.clear();
+        for (std::size_t i = 0; i <= page->placements.size(); ++i)
+        {
+            Assets::Image *packed = (i < page->placements.size()) ? page->placements[i].image : image;
+
+            stbrp_rect rect = {};
+            rect.id = static_cast<int>(i);
+            rect.w = packed->width + 2 * Padding;
+            rect.h = packed->height + 2 * Padding;
+            m_rects.push_back(rect);
+        }
+
+        // Trial run on scratch nodes so a failure leaves the page as it was. The packer is
+        // deterministic, the real run gives the same layout.
+        stbrp_context trial;
+        m_trialNodes.resize(static_cast<std::size_t>(m_pageSize));
+        stbrp_init_target(&trial, m_pageSize, m_pageSize, m_trialNodes.data(), static_cast<int>(m_trialNodes.size()));
+        if (!stbrp_pack_rects(&trial, m_rects.data(), static_cast<int>(m_rects.size())))
+        {
+            return false;
+        }
+
+        resetPage(page);
+        for (stbrp_rect &rect : m_rects)
+        {
+            rect.was_packed = 0;
+        }
+        stbrp_pack_rects(&page->context, m_rects.data(), static_cast<int>(m_rects.size()));
+
+        page->placements.push_back(Placement{image, region});
+        for (const stbrp_rect &rect : m_rects)
+        {
+            const Placement &placement = page->placements[static_cast<std::size_t>(rect.id)];
+            if (!placement.image->data)
+            {
+                Logger::error("TextureAtlas: Image '%s' was unloaded while in the atlas", placement.image->getId());
+                continue;
+            }
+            upload(page, placement.image, placement.region, rect.x, rect.y);
+        }
+
+        Logger::debug("TextureAtlas: Repacked a page with %zu images", page->placements.size());
+        return true;
+    }
+
+    void TextureAtlas::upload(Page *page, Assets::Image *image, TextureRegion *region, int x, int y) const
+    {
+        int width = image->width;
+        int height = image->height;
+        int paddedWidth = width + 2 * Padding;
+
+        // Gutters first, the page may hold stale pixels of an earlier layout
+        SDL_Rect top = {x, y, paddedWidth, Padding};
+        SDL_Rect bottom = {x, y + Padding + height, paddedWidth, Padding};
+        SDL_Rect left = {x, y + Padding, Padding, height};
+        SDL_Rect right = {x + Padding + width, y + Padding, Padding, height};
+        SDL_UpdateTexture(page->texture, &top, s_transparentPixels, paddedWidth * 4);
+        SDL_UpdateTexture(page->texture, &bottom, s_transparentPixels, paddedWidth * 4);
+        SDL_UpdateTexture(page->texture, &left, s_transparentPixels, Padding * 4);
+        SDL_UpdateTexture(page->texture, &right, s_transparentPixels, Padding * 4);
+
+        SDL_Rect destination = {x + Padding, y + Padding, width, height};
+        SDL_UpdateTexture(page->texture, &destination, image->data, width * 4);
+
+        const float pageSize = static_cast<float>(m_pageSize);
+        region->texture = page->texture;
+        region->rect = SDL_FRect{static_cast<float>(destination.x), static_cast<float>(destination.y), static_cast<float>(width), static_cast<float>(height)};
+        region->source = SDL_FRect{region->rect.x / pageSize, region->rect.y / pageSize, region->rect.w / pageSize, region->rect.h / pageSize};
+    }
+}
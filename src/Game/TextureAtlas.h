@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef PIXELPULSE_TEXTUREATLAS_H
+#define PIXELPULSE_TEXTUREATLAS_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "../Assets/Image.h"
+#include "../Assets/Atlas.h"
+
+namespace PixelPulse::Game
+{
+    // Where an image lives on the GPU, either a whole texture or a sub-rectangle of an atlas page
+    struct TextureRegion
+    {
+        SDL_Texture *texture;
+        SDL_FRect rect;   // In pixels
+        SDL_FRect source; // Normalized texture coordinates
+    };
+
+    // Packs images into a few large textures with the stb_rect_pack skyline packer, so sprites
+    // of different images share a texture and batch together. Pages are as large as the renderer
+    // allows, up to MaxPageSize, sized on the first insert. Packing is incremental. Space
+    // freed by remove() is reclaimed by repacking the page's remaining images once a new image
+    // no longer fits, which moves their regions in place. Callers must hold on to the region
+    // object, not a copy of it.
+    //
+    // Pages baked offline (see Assets::Atlas) are uploaded as they are, never packed: their
+    // images' regions point at the baked layout, and the page goes once its last region does.
+    class TextureAtlas
+    {
+    public:
+        static constexpr int MaxPageSize = 4096;
+        static constexpr int MinPageSize = 1024; // Renderers reporting less get no atlas
+        static constexpr std::size_t MaxPages = 4;
+        static constexpr int Padding = 1; // Transparent gutter against filtering bleed
+
+        TextureAtlas() = default;
+        TextureAtlas(const TextureAtlas &) = delete;
+        TextureAtlas &operator=(const TextureAtlas &) = delete;
+        ~TextureAtlas();
+
+        // Uploads the image into a page and points region at it, false if it does not fit anywhere
+        bool insert(SDL_Renderer *renderer, Assets::Image *image, TextureRegion *region);
+
+        // Points region at an image baked into the atlas, uploading its page on first use
+        bool insertBaked(SDL_Renderer *renderer, const Assets::Atlas &atlas, const Assets::AtlasEntry &entry, TextureRegion *region);
+
+        void remove(TextureRegion *region);
+
+        // Destroys every page and frees the packing state, regions still pointing into them become invalid
+        void clear();
+
+        std::size_t getPageCount() const { return m_pages.size() + m_bakedPages.size(); }
+
+        // 0 until the first insert, negative if the renderer cannot hold a page
+        int getPageSize() const { return m_pageSize; }
+
+        // Largest image that fits a page with its gutter
+        int getMaxImageSize() const { return m_pageSize - 2 * Padding; }
+
+    private:
+        struct Placement
+        {
+            Assets::Image *image;
+            TextureRegion *region;
+        };
+
+        struct Page
+        {
+            SDL_Texture *texture;
+            stbrp_context context;
+            Platform::Vector<stbrp_node, Platform::Memory::MemoryTag::Static> nodes;
+            Platform::Vector<Placement, Platform::Memory::MemoryTag::Static> placements;
+            std::int64_t freedArea; // Area given back by remove() that the packer cannot reuse yet
+        };
+
+        // A page of an Assets::Atlas, uploaded whole
+        struct BakedPage
+        {
+            const Assets::Atlas *atlas;
+            std::uint32_t index;
+            SDL_Texture *texture;
+            std::uint32_t regionCount;
+        };
+
+        Page *createPage(SDL_Renderer *renderer);
+        void resetPage(Page *page) const;
+        static Page *findPage(const Platform::Vector<Page *, Platform::Memory::MemoryTag::Static> &pages, SDL_Texture *texture);
+        bool pack(Page *page, Assets::Image *image, TextureRegion *region);
+        bool repack(Page *page, Assets::Image *image, TextureRegion *region);
+        void upload(Page *page, Assets::Image *image, TextureRegion *region, int x, int y) const;
+
+        // Pages are referenced by address from the placements' regions
+        Platform::Vector<Page *, Platform::Memory::MemoryTag::Static> m_pages;
+        Platform::Vector<BakedPage, Platform::Memory::MemoryTag::Static> m_bakedPages;
+
+        // Repack scratch, kept to avoid allocating on every repack
+        Platform::Vector<stbrp_rect, Platform::Memory::MemoryTag::Static> m_rects;
+        Platform::Vector<stbrp_node, Platform::Memory::MemoryTag::Static> m_trialNodes;
+
+        int m_pageSize = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,164 @@
+#include "TextureCache.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Game
+{
+    TextureCache &TextureCache::getInstance()
+    {
+        static TextureCache instance;
+        return instance;
+    }
+
+    TextureCache::~TextureCache()
+    {
+        clear();
+    }
+
+    const TextureRegion *TextureCache::acquire(SDL_Renderer *renderer, Assets::Image *image)
+    {
+        if (!image || !image->isLoaded() || !image->getId())
+        {
+            Logger::error("TextureCache: Image data is null");
+            return nullptr;
+        }
+
+        auto it = m_entries.find(std::string_view(image->getId()));
+        if (it != m_entries.end())
+        {
+            // A retired region still holds the retain of its last reference
+            if (it->second.refCount++ > 0)
+            {
+                image->retain();
+            }
+            return &it->second.region;
+        }
+
+        // Emplaced first, the atlas keeps the address of the region
+        Entry &entry = m_entries.emplace(std::string_view(image->getId()), Entry{TextureRegion{}, image, 1, false, false}).first->second;
+
+        // Baked images have no pixels of their own, their page is all there is
+        if (image->isBaked())
+        {
+            const Assets::Atlas *atlas = nullptr;
+            const Assets::AtlasEntry *atlasEntry = image->findAtlasEntry(&atlas);
+            entry.atlased = atlasEntry && m_atlas.insertBaked(renderer, *atlas, *atlasEntry, &entry.region);
+            if (!entry.atlased)
+            {
+                Logger::error("TextureCache: Baked image '%s' has no atlas page", image->getPath());
+                m_entries.erase(std::string_view(image->getId()));
+                return nullptr;
+            }
+        }
+        else
+        {
+            entry.atlased = m_atlasEnabled && m_atlas.insert(renderer, image, &entry.region);
+        }
+
+        if (!entry.atlased)
+        {
+            SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, image->width, image->height);
+            if (!texture)
+            {
+                Logger::error("TextureCache: Failed to create texture: %s", SDL_GetError());
+                m_entries.erase(std::string_view(image->getId()));
+                return nullptr;
+            }
+
+            SDL_UpdateTexture(texture, nullptr, image->data, image->width * 4);
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+            entry.region.texture = texture;
+            entry.region.rect = SDL_FRect{0.0f, 0.0f, static_cast<float>(image->width), static_cast<float>(image->height)};
+            entry.region.source = SDL_FRect{0.0f, 0.0f, 1.0f, 1.0f};
+        }
+
+        image->retain();
+
+        Logger::debug("TextureCache: Uploaded image '%s' (%s)%s", image->getPath(), image->getId(), entry.atlased ? " to the atlas" : "");
+        return &entry.region;
+    }
+
+    void TextureCache::release(Assets::Image *image)
+    {
+        if (!image || !image->getId())
+        {
+            return;
+        }
+
+        auto it = m_entries.find(std::string_view(image->getId()));
+        if (it == m_entries.end())
+        {
+            Logger::warning("TextureCache: Releasing image '%s' that has no texture", image->getId());
+            return;
+        }
+
+        Entry &entry = it->second;
+        entry.refCount--;
+        if (entry.refCount == 0)
+        {
+            // The region stays valid, and the entry keeps the image and its ID, until destroyRetired()
+            if (!entry.retired)
+            {
+                entry.retired = true;
+                m_retiredImages.push_back(image);
+            }
+            return;
+        }
+
+        image->release();
+    }
+
+    void TextureCache::destroyRetired()
+    {
+        for (Assets::Image *image : m_retiredImages)
+        {
+            auto it = m_entries.find(std::string_view(image->getId()));
+            Entry &entry = it->second;
+            entry.retired = false;
+
+            // Acquired again since
+            if (entry.refCount > 0)
+            {
+                continue;
+            }
+
+            if (entry.atlased)
+            {
+                m_atlas.remove(&entry.region);
+            }
+            else
+            {
+                SDL_DestroyTexture(entry.region.texture);
+            }
+
+            // After the erase, the key points into the image, which the last release may unload
+            m_entries.erase(it);
+            image->release();
+        }
+        m_retiredImages.clear();
+    }
+
+    void TextureCache::clear()
+    {
+        destroyRetired();
+
+        for (auto &[id, entry] : m_entries)
+        {
+            if (entry.refCount == 0)
+            {
+                continue;
+            }
+
+            Logger::warning("TextureCache: Texture for image '%s' still has %u references", entry.image->getId(), entry.refCount);
+            if (!entry.atlased)
+            {
+                SDL_DestroyTexture(entry.region.texture);
+            }
+        }
+
+        // Capacity is released too, the static instance outlives the memory system's leak report
+        decltype(m_entries)().swap(m_entries);
+        decltype(m_retiredImages)().swap(m_retiredImages);
+        m_atlas.clear();
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef PIXELPULSE_TEXTURECACHE_H
+#define PIXELPULSE_TEXTURECACHE_H
+
+#include "../Libraries/Libraries.h"
+#include "../Platform/Std.h"
+#include "../Platform/Containers.h"
+#include "../Assets/Image.h"
+#include "TextureAtlas.h"
+
+namespace PixelPulse::Game
+{
+    // One texture region per Image asset, keyed by the asset ID and shared by every sprite showing
+    // the image. Each acquire() retains the image and each release() releases it, so the image
+    // stays registered while any sprite uses it. The image is uploaded on the first acquire and
+    // its space freed with the last release. Main thread only, like the renderer.
+    //
+    // Images are packed into a TextureAtlas, so sprites of different images share a texture and
+    // batch together. Images too large for the atlas, or all of them when it is disabled, get a
+    // texture of their own. Regions move when a page is repacked, sprites keep the pointer.
+    // Images baked offline (see Assets::Atlas) always map into their uploaded page.
+    //
+    // A texture or atlas region whose last reference goes is only freed by destroyRetired(), since
+    // the render snapshot being drawn may still refer to it. Until then the entry and its region
+    // stay where they are and an acquire() of the same image takes them back.
+    class TextureCache
+    {
+    public:
+        static TextureCache &getInstance();
+
+        // Null if the image has no data or the texture cannot be created. The region stays valid
+        // until the matching release().
+        const TextureRegion *acquire(SDL_Renderer *renderer, Assets::Image *image);
+        void release(Assets::Image *image);
+
+        // Only affects images acquired afterwards
+        void setAtlasEnabled(bool enabled) { m_atlasEnabled = enabled; }
+        const TextureAtlas &getAtlas() const { return m_atlas; }
+
+        // Destroys the textures and frees the atlas regions released since the last call. Call once
+        // the frame that was drawing when they were released has been presented.
+        void destroyRetired();
+
+        // Destroys every texture, reporting the ones still referenced, and frees the cache's memory.
+        // Call before the renderer and the memory system go.
+        void clear();
+
+        std::size_t getTextureCount() const { return m_entries.size(); }
+
+    private:
+        struct Entry
+        {
+            TextureRegion region;
+            Assets::Image *image;
+            std::uint32_t refCount; // The entry retains the image once per reference, and once more while retired
+            bool atlased;
+            bool retired; // Listed in m_retiredImages
+        };
+
+        TextureCache() = default;
+        ~TextureCache();
+
+        TextureCache(const TextureCache &) = delete;
+        TextureCache &operator=(const TextureCache &) = delete;
+
+        // The key points at the image's ID, which lives as long as the entry retains the image.
+        // Map nodes do not move, the atlas and sprites point at the entries' regions.
+        Platform::UnorderedMap<std::string_view, Entry, Platform::Memory::MemoryTag::Static> m_entries;
+        TextureAtlas m_atlas;
+        Platform::Vector<Assets::Image *, Platform::Memory::MemoryTag::Static> m_retiredImages; // Retained by their entry
+        bool m_atlasEnabled = true;
+    };
+}
+
+#endif
@@ -5,7 +5,9 @@
 
 #ifdef PIXELPULSE_LIBRARIES_SHOULD_IMPLEMENT
 #define STB_IMAGE_IMPLEMENTATION
+#define STB_RECT_PACK_IMPLEMENTATION
 #endif
 #include <stb_image.h>
+#include <stb_rect_pack.h>
 
 #endif
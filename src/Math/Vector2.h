@@ -4,6 +4,7 @@
 #define PIXELPULSE_VECTOR2_H
 
 #include "../Platform/Std.h"
+#include <cmath>
 
 namespace PixelPulse::Math
 {
@@ -78,6 +79,15 @@ namespace PixelPulse::Math
             return x * x + y * y;
         }
 
+        // Angle in degrees, clockwise on screen since y points down
+        Vector2<T> rotate(T degrees) const
+        {
+            T radians = degrees * T(3.14159265358979323846 / 180.0);
+            T cosine = std::cos(radians);
+            T sine = std::sin(radians);
+            return Vector2<T>(x * cosine - y * sine, x * sine + y * cosine);
+        }
+
         using Float = Vector2<float>;
         using Double = Vector2<double>;
         using Int16 = Vector2<std::int16_t>;
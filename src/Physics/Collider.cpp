@@ -4,7 +4,7 @@
 namespace PixelPulse::Physics
 {
     Collider::Collider(RigidBody *body)
-        : m_body(body), m_offset(0.0f, 0.0f), m_listener(nullptr)
+        : m_body(body), m_offset(0.0f, 0.0f), m_listener(nullptr), m_worldIndex(0)
     {
     }
 
@@ -47,6 +47,11 @@ namespace PixelPulse::Physics
         RigidBody *m_body;
         Math::Vector2<float> m_offset;
         CollisionListener *m_listener;
+
+    private:
+        std::uint32_t m_worldIndex; // Position in the world's collider list, for O(1) removal
+
+        friend class PhysicsWorld;
     };
 
     class BoxCollider : public Collider
@@ -2,30 +2,32 @@
 #include "Collider.h"
 #include "RigidBody.h"
 #include "CollisionListener.h"
+#include "../Logger.h"
 #include <algorithm>
 #include <cmath>
 
 namespace PixelPulse::Physics
 {
     PhysicsWorld::PhysicsWorld()
-        : m_gravity(0.0f, 9.8f)
+        : m_bodies(MaxBodies), m_colliders(MaxColliders), m_gravity(0.0f, 9.8f)
     {
     }
 
     PhysicsWorld::~PhysicsWorld()
     {
-        for (auto body : m_bodies)
+        for (auto collider : m_colliders)
         {
-            delete body;
+            destroyCollider(collider);
         }
+        m_colliders.clear();
 
-        for (auto collider : m_colliders)
+        // The colliders are gone, so the body destructors have nothing left to remove
+        for (auto body : m_bodies)
         {
-            delete collider;
+            body->m_colliderCount = 0;
+            m_bodyPool.destroy(body);
         }
-
         m_bodies.clear();
-        m_colliders.clear();
     }
 
     void PhysicsWorld::update(float deltaTime)
@@ -49,23 +51,71 @@ namespace PixelPulse::Physics
 
     RigidBody *PhysicsWorld::createRigidBody(const Math::Vector2<float> &position)
     {
-        RigidBody *body = PP_NEW(RigidBody, this, position);
-        m_bodies.push_back(body);
+        RigidBody *body = m_bodyPool.create(this, position);
+        if (!body)
+        {
+            Logger::error("PhysicsWorld: Failed to allocate a rigid body");
+            return nullptr;
+        }
+
+        body->m_worldIndex = static_cast<std::uint32_t>(m_bodies.size());
+        if (!m_bodies.pushBack(body))
+        {
+            Logger::error("PhysicsWorld: No room for another rigid body (%zu)", m_bodies.size());
+            m_bodyPool.destroy(body);
+            return nullptr;
+        }
         return body;
     }
 
     BoxCollider *PhysicsWorld::createBoxCollider(RigidBody *body, const Math::Vector2<float> &size)
     {
-        BoxCollider *collider = PP_NEW(BoxCollider, body, size);
-        m_colliders.push_back(collider);
+        if (!body->canAddCollider())
+        {
+            Logger::error("PhysicsWorld: Body already has %zu colliders", RigidBody::MaxColliders);
+            return nullptr;
+        }
+
+        BoxCollider *collider = m_boxPool.create(body, size);
+        if (!collider)
+        {
+            Logger::error("PhysicsWorld: Failed to allocate a box collider");
+            return nullptr;
+        }
+
+        collider->m_worldIndex = static_cast<std::uint32_t>(m_colliders.size());
+        if (!m_colliders.pushBack(collider))
+        {
+            Logger::error("PhysicsWorld: No room for another collider (%zu)", m_colliders.size());
+            m_boxPool.destroy(collider);
+            return nullptr;
+        }
         body->addCollider(collider);
         return collider;
     }
 
     CircleCollider *PhysicsWorld::createCircleCollider(RigidBody *body, float radius)
     {
-        CircleCollider *collider = PP_NEW(CircleCollider, body, radius);
-        m_colliders.push_back(collider);
+        if (!body->canAddCollider())
+        {
+            Logger::error("PhysicsWorld: Body already has %zu colliders", RigidBody::MaxColliders);
+            return nullptr;
+        }
+
+        CircleCollider *collider = m_circlePool.create(body, radius);
+        if (!collider)
+        {
+            Logger::error("PhysicsWorld: Failed to allocate a circle collider");
+            return nullptr;
+        }
+
+        collider->m_worldIndex = static_cast<std::uint32_t>(m_colliders.size());
+        if (!m_colliders.pushBack(collider))
+        {
+            Logger::error("PhysicsWorld: No room for another collider (%zu)", m_colliders.size());
+            m_circlePool.destroy(collider);
+            return nullptr;
+        }
         body->addCollider(collider);
         return collider;
     }
@@ -80,45 +130,82 @@ namespace PixelPulse::Physics
         return m_gravity;
     }
 
+    // Bodies and colliders know their position in the world's lists and the last element is moved
+    // into the hole, so removal is O(1). Their order has no meaning to the simulation.
     void PhysicsWorld::removeRigidBody(RigidBody *body)
     {
-        auto it = std::find(m_bodies.begin(), m_bodies.end(), body);
-        if (it != m_bodies.end())
+        if (!body || body->m_worldIndex >= m_bodies.size() || m_bodies[body->m_worldIndex] != body)
         {
-            for (auto collider : body->m_colliders)
-            {
-                removeCollider(collider);
-            }
+            return;
+        }
 
-            m_bodies.erase(it);
-            PP_DELETE(body);
+        // removeCollider() takes the collider out of the body's list
+        while (body->m_colliderCount > 0)
+        {
+            removeCollider(body->m_colliders[body->m_colliderCount - 1]);
         }
+
+        RigidBody *last = m_bodies.back();
+        m_bodies[body->m_worldIndex] = last;
+        last->m_worldIndex = body->m_worldIndex;
+        m_bodies.popBack();
+
+        m_bodyPool.destroy(body);
     }
 
     void PhysicsWorld::removeCollider(Collider *collider)
     {
-        auto it = std::find(m_colliders.begin(), m_colliders.end(), collider);
-        if (it != m_colliders.end())
+        if (!collider || collider->m_worldIndex >= m_colliders.size() || m_colliders[collider->m_worldIndex] != collider)
         {
-            m_colliders.erase(it);
+            return;
+        }
+
+        Collider *last = m_colliders.back();
+        m_colliders[collider->m_worldIndex] = last;
+        last->m_worldIndex = collider->m_worldIndex;
+        m_colliders.popBack();
 
-            RigidBody *body = collider->getBody();
-            if (body)
+        // Contacts of the last step must not outlive the collider, the next step compares against them
+        for (std::size_t i = 0; i < m_currentCollisions.size();)
+        {
+            if (m_currentCollisions[i].first == collider || m_currentCollisions[i].second == collider)
             {
-                body->removeCollider(collider);
+                m_currentCollisions[i] = m_currentCollisions.back();
+                m_currentCollisions.pop_back();
             }
+            else
+            {
+                i++;
+            }
+        }
+
+        RigidBody *body = collider->getBody();
+        if (body)
+        {
+            body->removeCollider(collider);
+        }
+
+        destroyCollider(collider);
+    }
 
-            PP_DELETE(collider);
+    // Hands the collider back to the pool of its concrete type
+    void PhysicsWorld::destroyCollider(Collider *collider)
+    {
+        switch (collider->getType())
+        {
+        case ColliderType::Box:
+            m_boxPool.destroy(static_cast<BoxCollider *>(collider));
+            break;
+        case ColliderType::Circle:
+            m_circlePool.destroy(static_cast<CircleCollider *>(collider));
+            break;
         }
     }
 
     void PhysicsWorld::resolveCollisions()
     {
-        static std::vector<std::pair<Collider *, Collider *>> currentCollisions;
-        static std::vector<std::pair<Collider *, Collider *>> lastFrameCollisions;
-
-        std::swap(currentCollisions, lastFrameCollisions);
-        currentCollisions.clear();
+        std::swap(m_currentCollisions, m_lastFrameCollisions);
+        m_currentCollisions.clear();
 
         for (size_t i = 0; i < m_colliders.size(); i++)
         {
@@ -139,13 +226,13 @@ namespace PixelPulse::Physics
                 CollisionInfo info;
                 if (checkCollision(a, b, info))
                 {
-                    currentCollisions.push_back(std::make_pair(a, b));
+                    m_currentCollisions.push_back(std::make_pair(a, b));
 
                     CollisionListener *listenerA = a->getListener();
                     CollisionListener *listenerB = b->getListener();
 
                     bool wasColliding = false;
-                    for (const auto &pair : lastFrameCollisions)
+                    for (const auto &pair : m_lastFrameCollisions)
                     {
                         if ((pair.first == a && pair.second == b) ||
                             (pair.first == b && pair.second == a))
@@ -189,10 +276,10 @@ namespace PixelPulse::Physics
             }
         }
 
-        for (const auto &pair : lastFrameCollisions)
+        for (const auto &pair : m_lastFrameCollisions)
         {
             bool stillColliding = false;
-            for (const auto &currentPair : currentCollisions)
+            for (const auto &currentPair : m_currentCollisions)
             {
                 if ((currentPair.first == pair.first && currentPair.second == pair.second) ||
                     (currentPair.first == pair.second && currentPair.second == pair.first))
@@ -6,13 +6,19 @@
 #include "../Math/Vector2.h"
 #include "Collider.h"
 #include "RigidBody.h"
-#include <vector>
+#include "../Platform/Containers.h"
+#include "../Platform/Pool.h"
+#include "../Platform/VirtualMemory.h"
 
 namespace PixelPulse::Physics
 {
     class PhysicsWorld
     {
     public:
+        // Address space reserved for the body and collider lists, pages are committed as they fill
+        static constexpr std::size_t MaxBodies = 1 << 16;
+        static constexpr std::size_t MaxColliders = 1 << 16;
+
         PhysicsWorld();
         ~PhysicsWorld();
 
@@ -37,8 +43,20 @@ namespace PixelPulse::Physics
         bool checkCircleCircle(CircleCollider *a, CircleCollider *b, CollisionInfo &info);
         bool checkBoxCircle(BoxCollider *a, CircleCollider *b, CollisionInfo &info);
 
-        std::vector<RigidBody *> m_bodies;
-        std::vector<Collider *> m_colliders;
+        void destroyCollider(Collider *collider);
+
+        // Bodies and colliders live in pool slots, a spawn takes a free slot instead of a heap allocation
+        Platform::ObjectPool<RigidBody, Platform::Memory::MemoryTag::Physics> m_bodyPool;
+        Platform::ObjectPool<BoxCollider, Platform::Memory::MemoryTag::Physics> m_boxPool;
+        Platform::ObjectPool<CircleCollider, Platform::Memory::MemoryTag::Physics> m_circlePool;
+
+        // Grown in place, a spawn wave never copies the lists
+        Platform::Memory::VirtualArray<RigidBody *> m_bodies;
+        Platform::Memory::VirtualArray<Collider *> m_colliders;
+
+        // Contacts of the current and the previous step, compared to raise enter and exit events
+        Platform::Vector<std::pair<Collider *, Collider *>, Platform::Memory::MemoryTag::Physics> m_currentCollisions;
+        Platform::Vector<std::pair<Collider *, Collider *>, Platform::Memory::MemoryTag::Physics> m_lastFrameCollisions;
         Math::Vector2<float> m_gravity;
     };
 }
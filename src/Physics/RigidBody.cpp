@@ -1,22 +1,23 @@
 #include "RigidBody.h"
 #include "Collider.h"
 #include "PhysicsWorld.h"
+#include "../Logger.h"
+#include <algorithm>
 
 namespace PixelPulse::Physics
 {
     RigidBody::RigidBody(PhysicsWorld *world, const Math::Vector2<float> &position)
-        : m_world(world), m_position(position), m_velocity(0.0f, 0.0f), m_force(0.0f, 0.0f), m_rotation(0.0f), m_angularVelocity(0.0f), m_torque(0.0f), m_mass(1.0f), m_inverseMass(1.0f), m_inertia(0.0f), m_inverseInertia(0.0f), m_restitution(0.2f), m_friction(0.1f), m_isStatic(false)
+        : m_world(world), m_position(position), m_velocity(0.0f, 0.0f), m_force(0.0f, 0.0f), m_rotation(0.0f), m_angularVelocity(0.0f), m_torque(0.0f), m_mass(1.0f), m_inverseMass(1.0f), m_inertia(0.0f), m_inverseInertia(0.0f), m_restitution(0.2f), m_friction(0.1f), m_isStatic(false), m_worldIndex(0), m_colliders{}, m_colliderCount(0)
     {
     }
 
     RigidBody::~RigidBody()
     {
-        for (auto collider : m_colliders)
+        // removeCollider() takes the collider out of m_colliders
+        while (m_colliderCount > 0)
         {
-            m_world->removeCollider(collider);
+            m_world->removeCollider(m_colliders[m_colliderCount - 1]);
         }
-
-        m_colliders.clear();
     }
 
     void RigidBody::applyForce(const Math::Vector2<float> &force)
@@ -136,21 +137,38 @@ namespace PixelPulse::Physics
         return m_isStatic;
     }
 
+    bool RigidBody::canAddCollider() const
+    {
+        return m_colliderCount < MaxColliders;
+    }
+
     void RigidBody::addCollider(Collider *collider)
     {
-        if (std::find(m_colliders.begin(), m_colliders.end(), collider) == m_colliders.end())
+        Collider **end = m_colliders + m_colliderCount;
+        if (std::find(m_colliders, end, collider) != end)
         {
-            m_colliders.push_back(collider);
-            updateInertia();
+            return;
         }
+
+        if (!canAddCollider())
+        {
+            Logger::warning("RigidBody: Already has %zu colliders", MaxColliders);
+            return;
+        }
+
+        m_colliders[m_colliderCount++] = collider;
+        updateInertia();
     }
 
     void RigidBody::removeCollider(Collider *collider)
     {
-        auto it = std::find(m_colliders.begin(), m_colliders.end(), collider);
-        if (it != m_colliders.end())
+        Collider **end = m_colliders + m_colliderCount;
+        Collider **it = std::find(m_colliders, end, collider);
+        if (it != end)
         {
-            m_colliders.erase(it);
+            // Collider order does not matter, swap with the last one instead of shifting
+            *it = m_colliders[--m_colliderCount];
+            m_colliders[m_colliderCount] = nullptr;
             updateInertia();
         }
     }
@@ -181,8 +199,9 @@ namespace PixelPulse::Physics
 
         m_inertia = 0.0f;
 
-        for (auto collider : m_colliders)
+        for (std::uint32_t i = 0; i < m_colliderCount; ++i)
         {
+            Collider *collider = m_colliders[i];
             if (collider->getType() == ColliderType::Circle)
             {
                 CircleCollider *circle = static_cast<CircleCollider *>(collider);
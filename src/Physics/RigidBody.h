@@ -4,15 +4,20 @@
 #define PIXELPULSE_RIGIDBODY_H
 
 #include "../Math/Vector2.h"
+#include "../Platform/Containers.h"
 
 namespace PixelPulse::Physics
 {
     class PhysicsWorld;
     class Collider;
 
-    class RigidBody
+    // Cache-line aligned so the integration state (position, velocity, force, mass) shares one line
+    class alignas(Platform::Memory::CacheLineSize) RigidBody
     {
     public:
+        // Colliders are kept inline, attaching one never allocates
+        static constexpr std::size_t MaxColliders = 4;
+
         RigidBody(PhysicsWorld *world, const Math::Vector2<float> &position);
         ~RigidBody();
 
@@ -44,6 +49,7 @@ namespace PixelPulse::Physics
         void setStatic(bool isStatic);
         bool isStatic() const;
 
+        bool canAddCollider() const;
         void addCollider(Collider *collider);
         void removeCollider(Collider *collider);
 
@@ -71,7 +77,10 @@ namespace PixelPulse::Physics
 
         bool m_isStatic;
 
-        std::vector<Collider *> m_colliders;
+        std::uint32_t m_worldIndex; // Position in the world's body list, for O(1) removal
+
+        Collider *m_colliders[MaxColliders];
+        std::uint32_t m_colliderCount;
 
         friend class PhysicsWorld;
     };
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef PIXELPULSE_PLATFORM_CONTAINERS_H
+#define PIXELPULSE_PLATFORM_CONTAINERS_H
+
+#include "Platform/Std.h"
+#include "Platform/Memory.h"
+
+namespace PixelPulse::Platform
+{
+    // Engine containers, allocations go through MemoryAllocator under the given tag
+
+    template <typename T, Memory::MemoryTag Tag = Memory::MemoryTag::General>
+    using Vector = std::vector<T, Memory::Allocator<T, Tag>>;
+
+    template <typename Key, typename Value, Memory::MemoryTag Tag = Memory::MemoryTag::General,
+              typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using UnorderedMap = std::unordered_map<Key, Value, Hash, KeyEqual, Memory::Allocator<std::pair<const Key, Value>, Tag>>;
+}
+
+#endif
@@ -0,0 +1,244 @@
+#include "JobSystem.h"
+#include "../Logger.h"
+
+namespace PixelPulse::Platform
+{
+    static thread_local std::uint32_t s_threadIndex = 0;
+
+    bool JobQueue::push(const Job &job)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_bottom - m_top >= Capacity)
+        {
+            return false;
+        }
+
+        m_jobs[m_bottom % Capacity] = job;
+        m_bottom++;
+        return true;
+    }
+
+    bool JobQueue::pop(Job &job)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_bottom == m_top)
+        {
+            return false;
+        }
+
+        m_bottom--;
+        job = m_jobs[m_bottom % Capacity];
+        return true;
+    }
+
+    bool JobQueue::steal(Job &job)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_bottom == m_top)
+        {
+            return false;
+        }
+
+        job = m_jobs[m_top % Capacity];
+        m_top++;
+        return true;
+    }
+
+    JobSystem &JobSystem::getInstance()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+
+    JobSystem::JobSystem() : m_queues(nullptr),
+                             m_threadCount(1),
+                             m_running(false),
+                             m_queuedJobs(0)
+    {
+    }
+
+    JobSystem::~JobSystem()
+    {
+        shutdown();
+    }
+
+    std::uint32_t JobSystem::getCurrentThreadIndex()
+    {
+        return s_threadIndex;
+    }
+
+    bool JobSystem::initialize(std::uint32_t workerCount)
+    {
+        if (m_queues)
+        {
+            Logger::error("JobSystem: Already initialized");
+            return false;
+        }
+
+#ifdef PLATFORM_WASM
+        workerCount = 0;
+#else
+        if (workerCount == DefaultWorkerCount)
+        {
+            std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+#endif
+
+        m_threadCount = workerCount + 1;
+        m_queues = PP_NEW_ARRAY(JobQueue, m_threadCount);
+        m_running.store(true);
+
+        m_workers.reserve(workerCount);
+        for (std::uint32_t i = 1; i < m_threadCount; ++i)
+        {
+            m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+        }
+
+        Logger::info("JobSystem: Initialized with %u worker threads", workerCount);
+        return true;
+    }
+
+    void JobSystem::shutdown()
+    {
+        if (!m_queues)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_running.store(false);
+        }
+        m_wakeCondition.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+
+        PP_DELETE_ARRAY(m_queues, m_threadCount);
+        m_queues = nullptr;
+        m_threadCount = 1;
+    }
+
+    void JobSystem::schedule(const Job &job)
+    {
+        if (job.counter)
+        {
+            job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (!m_queues || m_threadCount == 1)
+        {
+            execute(job);
+            return;
+        }
+
+        // Counted before the push so a thief never sees the count go below zero
+        m_queuedJobs.fetch_add(1, std::memory_order_release);
+        if (!m_queues[std::min(s_threadIndex, m_threadCount - 1)].push(job))
+        {
+            m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            execute(job);
+            return;
+        }
+
+        // Taking the lock orders the notification after a worker's check of m_queuedJobs
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+        }
+        m_wakeCondition.notify_one();
+    }
+
+    void JobSystem::parallelFor(std::size_t count, std::size_t grainSize, JobFunction function, void *context, JobCounter &counter)
+    {
+        grainSize = std::max<std::size_t>(grainSize, 1);
+
+        for (std::size_t begin = 0; begin < count; begin += grainSize)
+        {
+            Job job;
+            job.function = function;
+            job.context = context;
+            job.begin = begin;
+            job.end = std::min(begin + grainSize, count);
+            job.counter = &counter;
+            schedule(job);
+        }
+    }
+
+    void JobSystem::wait(JobCounter &counter)
+    {
+        Job job;
+        while (!counter.isDone())
+        {
+            if (m_queues && findJob(s_threadIndex, job))
+            {
+                execute(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool JobSystem::findJob(std::uint32_t threadIndex, Job &job)
+    {
+        if (threadIndex >= m_threadCount)
+        {
+            threadIndex = 0;
+        }
+
+        if (m_queues[threadIndex].pop(job))
+        {
+            m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        for (std::uint32_t offset = 1; offset < m_threadCount; ++offset)
+        {
+            if (m_queues[(threadIndex + offset) % m_threadCount].steal(job))
+            {
+                m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::execute(const Job &job)
+    {
+        job.function(job.context, job.begin, job.end);
+
+        if (job.counter)
+        {
+            job.counter->pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void JobSystem::workerLoop(std::uint32_t threadIndex)
+    {
+        s_threadIndex = threadIndex;
+
+        Job job;
+        while (m_running.load(std::memory_order_acquire))
+        {
+            if (findJob(threadIndex, job))
+            {
+                execute(job);
+                continue;
+            }
+
+            auto hasWork = [this]()
+            {
+                return m_queuedJobs.load(std::memory_order_acquire) > 0 || !m_running.load(std::memory_order_acquire);
+            };
+
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wakeCondition.wait(lock, hasWork);
+        }
+    }
+}
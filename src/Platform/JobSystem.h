@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef PIXELPULSE_JOB_SYSTEM_H
+#define PIXELPULSE_JOB_SYSTEM_H
+
+#include "Platform/Std.h"
+#include "Platform/Memory.h"
+#include "Platform/Containers.h"
+
+namespace PixelPulse::Platform
+{
+    // Processes the range [begin, end) of whatever the context describes
+    using JobFunction = void (*)(void *context, std::size_t begin, std::size_t end);
+
+    // Fork/join point, counts the jobs scheduled against it that have not finished yet
+    struct JobCounter
+    {
+        std::atomic<std::uint32_t> pending{0};
+
+        bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    };
+
+    struct Job
+    {
+        JobFunction function;
+        void *context;
+        std::size_t begin;
+        std::size_t end;
+        JobCounter *counter;
+    };
+
+    // Bounded work-stealing deque. The owning thread pushes and pops at the bottom (newest
+    // first, while the data is still in cache), other threads steal from the top (oldest first).
+    class alignas(Memory::CacheLineSize) JobQueue
+    {
+    public:
+        static constexpr std::size_t Capacity = 1024;
+
+        bool push(const Job &job);
+        bool pop(Job &job);
+        bool steal(Job &job);
+
+    private:
+        std::mutex m_mutex;
+        std::size_t m_top = 0;
+        std::size_t m_bottom = 0;
+        Job m_jobs[Capacity];
+    };
+
+    // Worker threads with one JobQueue each. Thread 0 is the thread that called initialize(), it
+    // runs jobs while it waits on a counter, so it takes part in every fork/join. Scheduling
+    // never allocates, a full queue runs the job inline instead. On WASM, which is built without
+    // pthreads, there are no workers and every job runs on the calling thread.
+    class JobSystem
+    {
+    public:
+        static constexpr std::uint32_t DefaultWorkerCount = std::numeric_limits<std::uint32_t>::max();
+
+        static JobSystem &getInstance();
+
+        // Starts workerCount threads, by default one per hardware thread besides the main thread
+        bool initialize(std::uint32_t workerCount = DefaultWorkerCount);
+        void shutdown();
+
+        // Number of threads that run jobs, workers plus the main thread
+        std::uint32_t getThreadCount() const { return m_threadCount; }
+
+        // 0 on the main thread and any thread that is not a worker, 1 to getThreadCount() - 1 on workers
+        static std::uint32_t getCurrentThreadIndex();
+
+        void schedule(const Job &job);
+
+        // Splits [0, count) into jobs of at most grainSize items, all counted against counter
+        void parallelFor(std::size_t count, std::size_t grainSize, JobFunction function, void *context, JobCounter &counter);
+
+        // Runs queued jobs until every job counted against counter has finished
+        void wait(JobCounter &counter);
+
+    private:
+        JobSystem();
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        bool findJob(std::uint32_t threadIndex, Job &job);
+        void execute(const Job &job);
+        void workerLoop(std::uint32_t threadIndex);
+
+        JobQueue *m_queues;
+        std::uint32_t m_threadCount;
+        Vector<std::thread, Memory::MemoryTag::Static> m_workers;
+
+        std::atomic<bool> m_running;
+        std::atomic<std::uint32_t> m_queuedJobs;
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wakeCondition;
+    };
+
+    // One T per job system thread, each on its own cache line, for state that jobs write without
+    // locking (e.g. command buffers replayed on the main thread at a sync point)
+    template <typename T, Memory::MemoryTag Tag = Memory::MemoryTag::General>
+    class PerThread
+    {
+    public:
+        PerThread() : m_slots(JobSystem::getInstance().getThreadCount()) {}
+
+        T &local() { return m_slots[JobSystem::getCurrentThreadIndex()].value; }
+
+        T &operator[](std::size_t index) { return m_slots[index].value; }
+        const T &operator[](std::size_t index) const { return m_slots[index].value; }
+
+        std::size_t size() const { return m_slots.size(); }
+
+    private:
+        struct alignas(Memory::CacheLineSize) Slot
+        {
+            T value;
+        };
+
+        Vector<Slot, Tag> m_slots;
+    };
+}
+
+#endif
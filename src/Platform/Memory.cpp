@@ -5,6 +5,131 @@
 static bool g_memorySystemActive = false;
 static bool g_memorySystemInitialized = false;
 
+// Windows needs _aligned_free for _aligned_malloc blocks, so every block goes through the aligned
+// functions there. Elsewhere default-aligned blocks use malloc and over-aligned ones posix_memalign,
+// both of which are released with free.
+static void *systemAllocate(std::size_t size, std::size_t alignment)
+{
+#ifdef PLATFORM_WINDOWS
+    return ::_aligned_malloc(size, alignment);
+#else
+    if (alignment <= PixelPulse::Platform::Memory::DefaultAlignment)
+    {
+        return ::malloc(size);
+    }
+
+    void *ptr = nullptr;
+    if (::posix_memalign(&ptr, alignment, size) != 0)
+    {
+        return nullptr;
+    }
+    return ptr;
+#endif
+}
+
+static void systemFree(void *ptr)
+{
+#ifdef PLATFORM_WINDOWS
+    ::_aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif
+}
+
+#ifndef PIXELPULSE_DEBUG_HEAP
+// The alignment must be the one the block was allocated with
+static void *systemReallocate(void *ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment)
+{
+#ifdef PLATFORM_WINDOWS
+    return ::_aligned_realloc(ptr, newSize, alignment);
+#else
+    if (alignment <= PixelPulse::Platform::Memory::DefaultAlignment)
+    {
+        return ::realloc(ptr, newSize);
+    }
+
+    // No portable aligned realloc, move the block by hand
+    void *newPtr = systemAllocate(newSize, alignment);
+    if (newPtr)
+    {
+        std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+        systemFree(ptr);
+    }
+    return newPtr;
+#endif
+}
+
+// Heap block layout: [padding][BlockHeader][user data]
+// Every block knows its size and alignment, so reallocation keeps both without allocation tracking.
+struct BlockHeader
+{
+    std::size_t size;
+    std::size_t alignment;
+};
+
+static std::size_t blockHeaderSize(std::size_t alignment)
+{
+    return (sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1);
+}
+
+static BlockHeader *getBlockHeader(const void *ptr)
+{
+    return reinterpret_cast<BlockHeader *>(static_cast<unsigned char *>(const_cast<void *>(ptr)) - sizeof(BlockHeader));
+}
+
+static void *getBlockBase(const void *ptr)
+{
+    return static_cast<unsigned char *>(const_cast<void *>(ptr)) - blockHeaderSize(getBlockHeader(ptr)->alignment);
+}
+#endif
+
+#ifdef PIXELPULSE_DEBUG_HEAP
+// Debug heap block layout: [padding][GuardHeader][user data][rear canary]
+// The header sits directly in front of the user data so it can be found from the user pointer alone.
+struct GuardHeader
+{
+    std::size_t size;
+    std::size_t alignment;
+    std::uint64_t magic;
+    std::uint64_t canary;
+};
+
+static constexpr std::uint64_t GuardLiveMagic = 0x50504845414c4956ull;  // Block is allocated
+static constexpr std::uint64_t GuardFreedMagic = 0x50504845414644ddull; // Block was freed
+static constexpr std::uint64_t GuardCanaryValue = 0xfdfdfdfdfdfdfdfdull;
+static constexpr std::size_t GuardRearCanarySize = 16;
+static constexpr unsigned char GuardCanaryByte = 0xfd;
+static constexpr unsigned char GuardAllocatedByte = 0xcd; // Fresh memory, catches reads of uninitialized data
+static constexpr unsigned char GuardFreedByte = 0xdd;     // Freed memory, catches use-after-free
+
+static std::size_t guardHeaderSize(std::size_t alignment)
+{
+    return (sizeof(GuardHeader) + alignment - 1) & ~(alignment - 1);
+}
+
+static GuardHeader *getGuardHeader(const void *ptr)
+{
+    return reinterpret_cast<GuardHeader *>(static_cast<unsigned char *>(const_cast<void *>(ptr)) - sizeof(GuardHeader));
+}
+
+static void *getGuardBase(const void *ptr)
+{
+    return static_cast<unsigned char *>(const_cast<void *>(ptr)) - guardHeaderSize(getGuardHeader(ptr)->alignment);
+}
+
+static bool isFilledWith(const unsigned char *bytes, std::size_t size, unsigned char value)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (bytes[i] != value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 void PP_MemorySystemInitialize()
 {
     if (!g_memorySystemInitialized)
@@ -45,34 +170,134 @@ void PP_MemorySystemDumpStats()
         const auto &stats = PixelPulse::Platform::Memory::MemoryAllocator::getInstance().getStats();
         PixelPulse::Logger::info("Memory stats: %zu active allocations, %zu bytes in use, %zu peak bytes",
                                  stats.currentAllocations, stats.currentBytesAllocated, stats.peakBytesAllocated);
+        PixelPulse::Logger::info("Virtual memory: %zu bytes reserved, %zu bytes committed",
+                                 stats.reservedVirtualBytes, stats.committedVirtualBytes);
+
+        for (std::size_t i = 0; i < PixelPulse::Platform::Memory::MemoryTagCount; ++i)
+        {
+            PixelPulse::Logger::info("  [%s] %zu active allocations, %zu bytes in use",
+                                     PixelPulse::Platform::Memory::getMemoryTagName(static_cast<PixelPulse::Platform::Memory::MemoryTag>(i)),
+                                     stats.currentAllocationsByTag[i], stats.currentBytesByTag[i]);
+        }
+    }
+
+    if (g_memorySystemInitialized)
+    {
+        using PixelPulse::Platform::Memory::FrameAllocationStats;
+        using PixelPulse::Platform::Memory::MemoryAllocator;
+
+        FrameAllocationStats history[MemoryAllocator::FrameHistorySize];
+        std::size_t count = MemoryAllocator::getInstance().getFrameHistory(history, MemoryAllocator::FrameHistorySize);
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::size_t totalAllocations = 0;
+        std::size_t totalBytes = 0;
+        std::size_t worstAllocations = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            totalAllocations += history[i].allocations;
+            totalBytes += history[i].bytesAllocated;
+            worstAllocations = std::max(worstAllocations, history[i].allocations);
+        }
+
+        PixelPulse::Logger::info("Frame allocations: last frame %zu (%zu bytes), last %zu frames %zu total (%zu bytes), worst frame %zu",
+                                 history[0].allocations, history[0].bytesAllocated, count, totalAllocations, totalBytes, worstAllocations);
+    }
+}
+
+void PP_MemorySystemMarkFrame()
+{
+    if (g_memorySystemInitialized)
+    {
+        PixelPulse::Platform::Memory::MemoryAllocator::getInstance().markFrame();
     }
 }
 
 namespace PixelPulse::Platform::Memory
 {
+    const char *getMemoryTagName(MemoryTag tag)
+    {
+        switch (tag)
+        {
+        case MemoryTag::General:
+            return "General";
+        case MemoryTag::Static:
+            return "Static";
+        case MemoryTag::Scene:
+            return "Scene";
+        case MemoryTag::Physics:
+            return "Physics";
+        case MemoryTag::Assets:
+            return "Assets";
+        case MemoryTag::Count:
+            break;
+        }
+
+        return "Unknown";
+    }
+
     MemoryAllocator &MemoryAllocator::getInstance()
     {
         static MemoryAllocator instance;
         return instance;
     }
 
-    MemoryAllocator::MemoryAllocator()
+    MemoryAllocator::MemoryAllocator() : m_currentFrame{},
+                                         m_frameHistory{},
+                                         m_frameHistoryHead(0),
+                                         m_frameHistoryCount(0),
+                                         m_framePolicy(FrameAllocationPolicy::Ignore),
+                                         m_frameWarmup(0)
     {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        m_quarantineHead = 0;
+        m_quarantineCount = 0;
+        m_quarantineBytes = 0;
+#endif
+
         resetStats();
         PixelPulse::Logger::info("Memory allocator initialized");
     }
 
     MemoryAllocator::~MemoryAllocator()
     {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        while (m_quarantineCount > 0)
+        {
+            releaseOldestQuarantined();
+        }
+#endif
+
         PixelPulse::Logger::info("Memory allocator shutdown. Total allocations: %zu, Peak memory usage: %zu bytes",
                                  m_stats.totalAllocations, m_stats.peakBytesAllocated);
     }
 
-    void *MemoryAllocator::allocate(std::size_t size, const char *file, int line, const char *function)
+    void *MemoryAllocator::allocate(std::size_t size, const char *file, int line, const char *function, MemoryTag tag)
     {
+        return allocateAligned(size, DefaultAlignment, file, line, function, tag);
+    }
+
+    void *MemoryAllocator::allocateAligned(std::size_t size, std::size_t alignment, const char *file, int line, const char *function, MemoryTag tag)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        {
+            Logger::error("Memory allocation failed! Alignment %zu is not a power of two", alignment);
+            return nullptr;
+        }
+
+        alignment = std::max(alignment, DefaultAlignment);
+
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        void *ptr = ::malloc(size);
+        void *ptr = heapAllocate(size, alignment);
+
+        if (ptr)
+        {
+            recordFrameAllocation(size, file, line, function);
+        }
 
         if (ptr && g_memorySystemActive)
         {
@@ -80,6 +305,8 @@ namespace PixelPulse::Platform::Memory
             m_stats.currentAllocations++;
             m_stats.totalBytesAllocated += size;
             m_stats.currentBytesAllocated += size;
+            m_stats.currentAllocationsByTag[static_cast<std::size_t>(tag)]++;
+            m_stats.currentBytesByTag[static_cast<std::size_t>(tag)] += size;
 
             if (m_stats.currentBytesAllocated > m_stats.peakBytesAllocated)
             {
@@ -92,12 +319,14 @@ namespace PixelPulse::Platform::Memory
             record.file = file;
             record.line = line;
             record.function = function;
+            record.tag = tag;
+            record.alignment = alignment;
 
             m_allocations[ptr] = record;
         }
         else if (!ptr)
         {
-            Logger::error("Memory allocation failed! Requested size: %zu bytes", size);
+            Logger::error("Memory allocation failed! Requested size: %zu bytes, alignment: %zu", size, alignment);
         }
 
         return ptr;
@@ -105,35 +334,42 @@ namespace PixelPulse::Platform::Memory
 
     void *MemoryAllocator::reallocate(void *ptr, std::size_t newSize, const char *file, int line, const char *function)
     {
-        if (!g_memorySystemActive)
+        if (!ptr)
         {
-            return ::realloc(ptr, newSize);
+            return allocate(newSize, file, line, function);
         }
 
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        if (!ptr)
+        recordFrameAllocation(newSize, file, line, function);
+
+        if (!g_memorySystemActive)
         {
-            return allocate(newSize, file, line, function);
+            return heapReallocate(ptr, newSize, nullptr);
         }
 
         auto it = m_allocations.find(ptr);
         if (it == m_allocations.end())
         {
-            return ::realloc(ptr, newSize);
+            return heapReallocate(ptr, newSize, nullptr);
         }
 
         std::size_t oldSize = it->second.size;
+        std::size_t alignment = it->second.alignment;
+        MemoryTag tag = it->second.tag;
+        std::size_t tagIndex = static_cast<std::size_t>(tag);
 
         m_stats.currentBytesAllocated -= oldSize;
+        m_stats.currentBytesByTag[tagIndex] -= oldSize;
 
-        void *newPtr = ::realloc(ptr, newSize);
+        void *newPtr = heapReallocate(ptr, newSize, &it->second);
 
         if (newPtr)
         {
             m_stats.totalAllocations++;
             m_stats.totalBytesAllocated += newSize;
             m_stats.currentBytesAllocated += newSize;
+            m_stats.currentBytesByTag[tagIndex] += newSize;
 
             if (m_stats.currentBytesAllocated > m_stats.peakBytesAllocated)
             {
@@ -148,12 +384,15 @@ namespace PixelPulse::Platform::Memory
             record.file = file;
             record.line = line;
             record.function = function;
+            record.tag = tag;
+            record.alignment = alignment;
 
             m_allocations[newPtr] = record;
         }
         else
         {
             m_stats.currentBytesAllocated += oldSize;
+            m_stats.currentBytesByTag[tagIndex] += oldSize;
             Logger::error("Memory reallocation failed! Current size: %zu bytes, Requested size: %zu bytes", oldSize, newSize);
         }
 
@@ -165,30 +404,233 @@ namespace PixelPulse::Platform::Memory
         if (!ptr)
             return;
 
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_currentFrame.deallocations++;
+
         if (!g_memorySystemActive)
         {
-            ::free(ptr);
+            heapFree(ptr, nullptr);
             return;
         }
 
-        std::lock_guard<std::mutex> lock(m_mutex);
-
         auto it = m_allocations.find(ptr);
         if (it != m_allocations.end())
         {
+            std::size_t tagIndex = static_cast<std::size_t>(it->second.tag);
+
             m_stats.currentAllocations--;
             m_stats.currentBytesAllocated -= it->second.size;
+            m_stats.currentAllocationsByTag[tagIndex]--;
+            m_stats.currentBytesByTag[tagIndex] -= it->second.size;
+
+            heapFree(ptr, &it->second);
 
             m_allocations.erase(it);
+        }
+        else
+        {
+            heapFree(ptr, nullptr);
+        }
+    }
+
+    void *MemoryAllocator::heapAllocate(std::size_t size, std::size_t alignment)
+    {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        std::size_t headerSize = guardHeaderSize(alignment);
+        unsigned char *base = static_cast<unsigned char *>(systemAllocate(headerSize + size + GuardRearCanarySize, alignment));
+        if (!base)
+        {
+            return nullptr;
+        }
 
-            ::free(ptr);
+        unsigned char *ptr = base + headerSize;
+
+        GuardHeader *header = getGuardHeader(ptr);
+        header->size = size;
+        header->alignment = alignment;
+        header->magic = GuardLiveMagic;
+        header->canary = GuardCanaryValue;
+
+        std::memset(ptr, GuardAllocatedByte, size);
+        std::memset(ptr + size, GuardCanaryByte, GuardRearCanarySize);
+
+        return ptr;
+#else
+        std::size_t headerSize = blockHeaderSize(alignment);
+        unsigned char *base = static_cast<unsigned char *>(systemAllocate(headerSize + size, alignment));
+        if (!base)
+        {
+            return nullptr;
+        }
+
+        unsigned char *ptr = base + headerSize;
+
+        BlockHeader *header = getBlockHeader(ptr);
+        header->size = size;
+        header->alignment = alignment;
+        return ptr;
+#endif
+    }
+
+    void *MemoryAllocator::heapReallocate(void *ptr, std::size_t newSize, const AllocationRecord *record)
+    {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        // Always move the block, so stale pointers to the old one land in poisoned memory
+        if (!verifyGuards(ptr, "reallocate", record))
+        {
+            return nullptr;
+        }
+
+        const GuardHeader *header = getGuardHeader(ptr);
+        void *newPtr = heapAllocate(newSize, header->alignment);
+        if (newPtr)
+        {
+            std::memcpy(newPtr, ptr, std::min(header->size, newSize));
+            heapFree(ptr, record);
+        }
+        return newPtr;
+#else
+        PIXELPULSE_ARG_UNUSED(record);
+
+        // The header moves with the block, and the user data keeps its offset from the base
+        std::size_t alignment = getBlockHeader(ptr)->alignment;
+        std::size_t headerSize = blockHeaderSize(alignment);
+        unsigned char *base = static_cast<unsigned char *>(systemReallocate(getBlockBase(ptr), headerSize + getBlockHeader(ptr)->size,
+                                                                            headerSize + newSize, alignment));
+        if (!base)
+        {
+            return nullptr;
+        }
+
+        unsigned char *newPtr = base + headerSize;
+        getBlockHeader(newPtr)->size = newSize;
+        return newPtr;
+#endif
+    }
+
+    void MemoryAllocator::heapFree(void *ptr, const AllocationRecord *record)
+    {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        if (!verifyGuards(ptr, "free", record))
+        {
+            // Leak the block rather than hand corrupted memory back to the system
+            return;
+        }
+
+        GuardHeader *header = getGuardHeader(ptr);
+        header->magic = GuardFreedMagic;
+        std::memset(ptr, GuardFreedByte, header->size);
+
+        while (m_quarantineCount > 0 &&
+               (m_quarantineCount == QuarantineSize || m_quarantineBytes + header->size > QuarantineMaxBytes))
+        {
+            releaseOldestQuarantined();
+        }
+
+        QuarantineEntry &entry = m_quarantine[(m_quarantineHead + m_quarantineCount) % QuarantineSize];
+        entry.address = ptr;
+        entry.file = record ? record->file : nullptr;
+        entry.line = record ? record->line : 0;
+        entry.function = record ? record->function : nullptr;
+
+        m_quarantineCount++;
+        m_quarantineBytes += header->size;
+#else
+        PIXELPULSE_ARG_UNUSED(record);
+        systemFree(getBlockBase(ptr));
+#endif
+    }
+
+#ifdef PIXELPULSE_DEBUG_HEAP
+    bool MemoryAllocator::verifyGuards(const void *ptr, const char *operation, const AllocationRecord *record) const
+    {
+        const GuardHeader *header = getGuardHeader(ptr);
+        const char *problem = nullptr;
+
+        if (header->magic == GuardFreedMagic)
+        {
+            problem = "block was already freed";
+        }
+        else if (header->magic != GuardLiveMagic || header->canary != GuardCanaryValue)
+        {
+            problem = "front canary damaged (buffer underrun or foreign pointer)";
+        }
+        else if (!isFilledWith(static_cast<const unsigned char *>(ptr) + header->size, GuardRearCanarySize, GuardCanaryByte))
+        {
+            problem = "rear canary damaged (buffer overrun)";
+        }
+
+        if (!problem)
+        {
+            return true;
+        }
+
+        if (record && record->file && record->function)
+        {
+            Logger::fatal("Heap corruption on %s of %p: %s - allocated at %s:%d in %s",
+                          operation, ptr, problem, record->file, record->line, record->function);
         }
         else
         {
-            ::free(ptr);
+            Logger::fatal("Heap corruption on %s of %p: %s - unknown allocation site", operation, ptr, problem);
         }
+
+        return false;
     }
 
+    bool MemoryAllocator::verifyPoison(const QuarantineEntry &entry) const
+    {
+        const GuardHeader *header = getGuardHeader(entry.address);
+        if (header->magic == GuardFreedMagic && header->canary == GuardCanaryValue &&
+            isFilledWith(static_cast<const unsigned char *>(entry.address), header->size, GuardFreedByte))
+        {
+            return true;
+        }
+
+        if (entry.file && entry.function)
+        {
+            Logger::fatal("Use-after-free write to freed block %p - allocated at %s:%d in %s",
+                          entry.address, entry.file, entry.line, entry.function);
+        }
+        else
+        {
+            Logger::fatal("Use-after-free write to freed block %p - unknown allocation site", entry.address);
+        }
+
+        return false;
+    }
+
+    void MemoryAllocator::checkHeapLocked() const
+    {
+        for (const auto &pair : m_allocations)
+        {
+            verifyGuards(pair.first, "heap check", &pair.second);
+        }
+
+        for (std::size_t i = 0; i < m_quarantineCount; ++i)
+        {
+            verifyPoison(m_quarantine[(m_quarantineHead + i) % QuarantineSize]);
+        }
+    }
+
+    void MemoryAllocator::releaseOldestQuarantined()
+    {
+        const QuarantineEntry &entry = m_quarantine[m_quarantineHead];
+        std::size_t size = getGuardHeader(entry.address)->size;
+
+        // A damaged block is reported and leaked, its memory can no longer be trusted
+        if (verifyPoison(entry))
+        {
+            systemFree(getGuardBase(entry.address));
+        }
+
+        m_quarantineHead = (m_quarantineHead + 1) % QuarantineSize;
+        m_quarantineCount--;
+        m_quarantineBytes -= std::min(size, m_quarantineBytes);
+    }
+#endif
+
     const MemoryStats &MemoryAllocator::getStats() const
     {
         return m_stats;
@@ -204,9 +646,116 @@ namespace PixelPulse::Platform::Memory
         m_stats.currentBytesAllocated = 0;
         m_stats.peakBytesAllocated = 0;
 
+        for (std::size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            m_stats.currentAllocationsByTag[i] = 0;
+            m_stats.currentBytesByTag[i] = 0;
+        }
+
+        m_stats.reservedVirtualBytes = 0;
+        m_stats.committedVirtualBytes = 0;
+
         m_allocations.clear();
     }
 
+    void MemoryAllocator::addVirtualMemory(std::size_t reservedBytes, std::size_t committedBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stats.reservedVirtualBytes += reservedBytes;
+        m_stats.committedVirtualBytes += committedBytes;
+    }
+
+    void MemoryAllocator::removeVirtualMemory(std::size_t reservedBytes, std::size_t committedBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stats.reservedVirtualBytes -= std::min(reservedBytes, m_stats.reservedVirtualBytes);
+        m_stats.committedVirtualBytes -= std::min(committedBytes, m_stats.committedVirtualBytes);
+    }
+
+    void MemoryAllocator::markFrame()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+#ifdef PIXELPULSE_DEBUG_HEAP
+        checkHeapLocked();
+#endif
+
+        m_frameHistory[m_frameHistoryHead] = m_currentFrame;
+        m_frameHistoryHead = (m_frameHistoryHead + 1) % FrameHistorySize;
+        if (m_frameHistoryCount < FrameHistorySize)
+        {
+            m_frameHistoryCount++;
+        }
+
+        std::uint64_t nextFrameIndex = m_currentFrame.frameIndex + 1;
+        m_currentFrame = FrameAllocationStats{};
+        m_currentFrame.frameIndex = nextFrameIndex;
+    }
+
+    void MemoryAllocator::checkHeap()
+    {
+#ifdef PIXELPULSE_DEBUG_HEAP
+        std::lock_guard<std::mutex> lock(m_mutex);
+        checkHeapLocked();
+#endif
+    }
+
+    void MemoryAllocator::setFrameAllocationPolicy(FrameAllocationPolicy policy, std::uint64_t warmupFrames)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_framePolicy = policy;
+        m_frameWarmup = m_currentFrame.frameIndex + warmupFrames;
+    }
+
+    std::size_t MemoryAllocator::getFrameHistory(FrameAllocationStats *out, std::size_t maxCount) const
+    {
+        if (!out)
+        {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(const_cast<std::mutex &>(m_mutex));
+
+        std::size_t count = std::min(maxCount, m_frameHistoryCount);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = m_frameHistory[(m_frameHistoryHead + FrameHistorySize - 1 - i) % FrameHistorySize];
+        }
+
+        return count;
+    }
+
+    void MemoryAllocator::recordFrameAllocation(std::size_t size, const char *file, int line, const char *function)
+    {
+        m_currentFrame.allocations++;
+        m_currentFrame.bytesAllocated += size;
+
+        if (m_framePolicy == FrameAllocationPolicy::Ignore || m_currentFrame.frameIndex < m_frameWarmup)
+        {
+            return;
+        }
+
+        if (!file || !function)
+        {
+            file = "unknown";
+            function = "unknown";
+        }
+
+        if (m_framePolicy == FrameAllocationPolicy::Fatal)
+        {
+            Logger::fatal("Allocation during frame %llu: %zu bytes - %s:%d in %s",
+                          static_cast<unsigned long long>(m_currentFrame.frameIndex), size, file, line, function);
+        }
+        else
+        {
+            Logger::warning("Allocation during frame %llu: %zu bytes - %s:%d in %s",
+                            static_cast<unsigned long long>(m_currentFrame.frameIndex), size, file, line, function);
+        }
+    }
+
     void MemoryAllocator::dumpLeaks() const
     {
         if (!g_memorySystemActive)
@@ -216,27 +765,36 @@ namespace PixelPulse::Platform::Memory
 
         std::lock_guard<std::mutex> lock(const_cast<std::mutex &>(m_mutex));
 
-        if (m_allocations.empty())
+        // Allocations owned by static singletons are still alive at this point by design
+        const std::size_t staticIndex = static_cast<std::size_t>(MemoryTag::Static);
+        std::size_t leakCount = m_allocations.size() - m_stats.currentAllocationsByTag[staticIndex];
+        std::size_t leakBytes = m_stats.currentBytesAllocated - m_stats.currentBytesByTag[staticIndex];
+
+        if (leakCount == 0)
         {
             Logger::info("No memory leaks detected");
             return;
         }
 
-        Logger::warning("Memory leaks detected: %zu allocations, %zu bytes",
-                        m_allocations.size(), m_stats.currentBytesAllocated);
+        Logger::warning("Memory leaks detected: %zu allocations, %zu bytes", leakCount, leakBytes);
 
         for (const auto &pair : m_allocations)
         {
             const AllocationRecord &record = pair.second;
+            if (record.tag == MemoryTag::Static)
+            {
+                continue;
+            }
+
             if (record.file && record.function)
             {
-                Logger::warning("Leak: %zu bytes at %p - %s:%d in %s",
-                                record.size, record.address, record.file, record.line, record.function);
+                Logger::warning("Leak: %zu bytes at %p [%s] - %s:%d in %s",
+                                record.size, record.address, getMemoryTagName(record.tag), record.file, record.line, record.function);
             }
             else
             {
-                Logger::warning("Leak: %zu bytes at %p - unknown location",
-                                record.size, record.address);
+                Logger::warning("Leak: %zu bytes at %p [%s] - unknown location",
+                                record.size, record.address, getMemoryTagName(record.tag));
             }
         }
     }
@@ -255,4 +813,48 @@ namespace PixelPulse::Platform::Memory
     {
         MemoryAllocator::getInstance().deallocate(ptr);
     }
+
+    void *MemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        void *memory = MemoryAllocator::getInstance().allocateAligned(bytes, alignment, nullptr, 0, nullptr, m_tag);
+        if (!memory)
+        {
+            throw std::bad_alloc();
+        }
+
+        return memory;
+    }
+
+    void MemoryResource::do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment)
+    {
+        PIXELPULSE_ARG_UNUSED(bytes);
+        PIXELPULSE_ARG_UNUSED(alignment);
+
+        MemoryAllocator::getInstance().deallocate(ptr);
+    }
+
+    bool MemoryResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    {
+        const MemoryResource *resource = dynamic_cast<const MemoryResource *>(&other);
+        return resource && resource->m_tag == m_tag;
+    }
+
+    std::pmr::memory_resource *getMemoryResource(MemoryTag tag)
+    {
+        static MemoryResource resources[MemoryTagCount] = {
+            MemoryResource(MemoryTag::General),
+            MemoryResource(MemoryTag::Static),
+            MemoryResource(MemoryTag::Scene),
+            MemoryResource(MemoryTag::Physics),
+            MemoryResource(MemoryTag::Assets),
+        };
+
+        std::size_t index = static_cast<std::size_t>(tag);
+        if (index >= MemoryTagCount)
+        {
+            index = static_cast<std::size_t>(MemoryTag::General);
+        }
+
+        return &resources[index];
+    }
 }
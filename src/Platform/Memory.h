@@ -9,9 +9,27 @@ void PP_MemorySystemInitialize();     // Initialize the memory system
 void PP_MemorySystemEnableTracking(); // Begin tracking memory allocations
 void PP_MemorySystemShutdown();       // Shutdown the memory system and report leaks
 void PP_MemorySystemDumpStats();      // Print current memory statistics
+void PP_MemorySystemMarkFrame();      // Close the current frame's allocation counters
 
 namespace PixelPulse::Platform::Memory
 {
+    enum class MemoryTag : std::uint8_t
+    {
+        General,  // Untagged allocations
+        Static,   // Owned by static singletons, outlives the memory system and is not reported as a leak
+        Scene,    // Scene graph nodes and entity lists
+        Physics,  // Rigid bodies, colliders and their lists
+        Assets,   // Asset registry bookkeeping
+        Count
+    };
+
+    const char *getMemoryTagName(MemoryTag tag);
+
+    constexpr std::size_t MemoryTagCount = static_cast<std::size_t>(MemoryTag::Count);
+
+    constexpr std::size_t DefaultAlignment = alignof(std::max_align_t); // Alignment of plain allocate()/PP_MALLOC blocks
+    constexpr std::size_t CacheLineSize = 64;                           // Alignment for data that must not share a cache line
+
     struct MemoryStats
     {
         std::size_t totalAllocations;      // Total number of allocations
@@ -19,6 +37,27 @@ namespace PixelPulse::Platform::Memory
         std::size_t totalBytesAllocated;   // Total bytes allocated since start
         std::size_t currentBytesAllocated; // Current bytes in use
         std::size_t peakBytesAllocated;    // Peak memory usage
+
+        std::size_t currentAllocationsByTag[MemoryTagCount]; // Current number of active allocations per tag
+        std::size_t currentBytesByTag[MemoryTagCount];       // Current bytes in use per tag
+
+        std::size_t reservedVirtualBytes;  // Address space reserved by virtual arenas
+        std::size_t committedVirtualBytes; // Pages committed by virtual arenas
+    };
+
+    struct FrameAllocationStats
+    {
+        std::uint64_t frameIndex;     // Index of the frame these counters belong to
+        std::size_t allocations;      // Allocations made during the frame
+        std::size_t bytesAllocated;   // Bytes allocated during the frame
+        std::size_t deallocations;    // Deallocations made during the frame
+    };
+
+    enum class FrameAllocationPolicy
+    {
+        Ignore, // Only count allocations
+        Log,    // Log every allocation made after the warm-up period
+        Fatal   // Trap via Logger::fatal on the first allocation after the warm-up period
     };
 
     struct AllocationRecord
@@ -28,6 +67,8 @@ namespace PixelPulse::Platform::Memory
         const char *file;     // Source file
         int line;             // Line number
         const char *function; // Function name
+        MemoryTag tag;        // Subsystem the allocation belongs to
+        std::size_t alignment; // Alignment the block was allocated with
     };
 
     class MemoryAllocator
@@ -35,7 +76,10 @@ namespace PixelPulse::Platform::Memory
     public:
         static MemoryAllocator &getInstance();
 
-        void *allocate(std::size_t size, const char *file = nullptr, int line = 0, const char *function = nullptr);
+        void *allocate(std::size_t size, const char *file = nullptr, int line = 0, const char *function = nullptr, MemoryTag tag = MemoryTag::General);
+        void *allocateAligned(std::size_t size, std::size_t alignment, const char *file = nullptr, int line = 0, const char *function = nullptr, MemoryTag tag = MemoryTag::General);
+
+        // Reallocation keeps the block's alignment, tracked or not
         void *reallocate(void *ptr, std::size_t newSize, const char *file = nullptr, int line = 0, const char *function = nullptr);
         void deallocate(void *ptr);
 
@@ -43,6 +87,25 @@ namespace PixelPulse::Platform::Memory
         void dumpLeaks() const;
         void resetStats();
 
+        // Reported by VirtualArena, virtual memory is counted whether or not tracking is active
+        void addVirtualMemory(std::size_t reservedBytes, std::size_t committedBytes);
+        void removeVirtualMemory(std::size_t reservedBytes, std::size_t committedBytes);
+
+        // Frame allocation tracking, frames are delimited by markFrame()
+        static constexpr std::size_t FrameHistorySize = 120;
+
+        void markFrame();
+
+        // Verifies the canaries of live tracked blocks and the poison of quarantined blocks,
+        // does nothing unless built with PIXELPULSE_DEBUG_HEAP
+        void checkHeap();
+
+        void setFrameAllocationPolicy(FrameAllocationPolicy policy, std::uint64_t warmupFrames = 0);
+        const FrameAllocationStats &getCurrentFrameStats() const { return m_currentFrame; }
+
+        // Copies up to maxCount completed frames into out, most recent first, returns the number copied
+        std::size_t getFrameHistory(FrameAllocationStats *out, std::size_t maxCount) const;
+
     private:
         MemoryAllocator();
         ~MemoryAllocator();
@@ -50,16 +113,52 @@ namespace PixelPulse::Platform::Memory
         MemoryAllocator(const MemoryAllocator &) = delete;
         MemoryAllocator &operator=(const MemoryAllocator &) = delete;
 
+        void recordFrameAllocation(std::size_t size, const char *file, int line, const char *function);
+
+        void *heapAllocate(std::size_t size, std::size_t alignment);
+        void *heapReallocate(void *ptr, std::size_t newSize, const AllocationRecord *record);
+        void heapFree(void *ptr, const AllocationRecord *record);
+
+#ifdef PIXELPULSE_DEBUG_HEAP
+        struct QuarantineEntry
+        {
+            void *address;        // User pointer of the freed block
+            const char *file;     // Allocation site, if the block was tracked
+            int line;
+            const char *function;
+        };
+
+        static constexpr std::size_t QuarantineSize = 1024;
+        static constexpr std::size_t QuarantineMaxBytes = 4 * 1024 * 1024;
+
+        bool verifyGuards(const void *ptr, const char *operation, const AllocationRecord *record) const;
+        bool verifyPoison(const QuarantineEntry &entry) const;
+        void checkHeapLocked() const;
+        void releaseOldestQuarantined();
+
+        QuarantineEntry m_quarantine[QuarantineSize];
+        std::size_t m_quarantineHead;
+        std::size_t m_quarantineCount;
+        std::size_t m_quarantineBytes;
+#endif
+
         std::unordered_map<void *, AllocationRecord> m_allocations;
         MemoryStats m_stats;
         std::mutex m_mutex;
+
+        FrameAllocationStats m_currentFrame;
+        FrameAllocationStats m_frameHistory[FrameHistorySize];
+        std::size_t m_frameHistoryHead;
+        std::size_t m_frameHistoryCount;
+        FrameAllocationPolicy m_framePolicy;
+        std::uint64_t m_frameWarmup;
     };
 
     template <typename T, typename... Args>
     T *allocateObject(const char *file, int line, const char *function, Args &&...args)
     {
-        void *memory = PixelPulse::Platform::Memory::MemoryAllocator::getInstance().allocate(
-            sizeof(T), file, line, function);
+        void *memory = PixelPulse::Platform::Memory::MemoryAllocator::getInstance().allocateAligned(
+            sizeof(T), alignof(T), file, line, function);
         return new (memory) T(std::forward<Args>(args)...);
     }
 
@@ -76,8 +175,8 @@ namespace PixelPulse::Platform::Memory
     template <typename T>
     T *allocateArray(size_t count, const char *file, int line, const char *function)
     {
-        void *memory = PixelPulse::Platform::Memory::MemoryAllocator::getInstance().allocate(
-            sizeof(T) * count, file, line, function);
+        void *memory = PixelPulse::Platform::Memory::MemoryAllocator::getInstance().allocateAligned(
+            sizeof(T) * count, alignof(T), file, line, function);
 
         T *typedMemory = static_cast<T *>(memory);
         for (size_t i = 0; i < count; ++i)
@@ -104,6 +203,74 @@ namespace PixelPulse::Platform::Memory
     void *allocate(size_t size, const char *file, int line, const char *function);
     void *reallocate(void *ptr, size_t newSize, const char *file, int line, const char *function);
     void free(void *ptr);
+
+    // Standard library allocator routed through MemoryAllocator, the tag is part of the type so
+    // containers of different subsystems show up separately in stats and leak reports
+    template <typename T, MemoryTag Tag = MemoryTag::General>
+    class Allocator
+    {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = Allocator<U, Tag>;
+        };
+
+        Allocator() noexcept = default;
+
+        template <typename U>
+        Allocator(const Allocator<U, Tag> &) noexcept
+        {
+        }
+
+        T *allocate(std::size_t count)
+        {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                throw std::bad_array_new_length();
+            }
+
+            void *memory = MemoryAllocator::getInstance().allocateAligned(sizeof(T) * count, alignof(T), nullptr, 0, nullptr, Tag);
+            if (!memory)
+            {
+                throw std::bad_alloc();
+            }
+
+            return static_cast<T *>(memory);
+        }
+
+        void deallocate(T *ptr, std::size_t /*count*/) noexcept
+        {
+            MemoryAllocator::getInstance().deallocate(ptr);
+        }
+
+        template <typename U>
+        bool operator==(const Allocator<U, Tag> &) const noexcept
+        {
+            return true;
+        }
+    };
+
+    // Polymorphic memory resource for code using std::pmr containers
+    class MemoryResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit MemoryResource(MemoryTag tag) : m_tag(tag) {}
+
+        MemoryTag getTag() const { return m_tag; }
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        MemoryTag m_tag;
+    };
+
+    // Returns the shared resource for the given tag, valid for the lifetime of the program
+    std::pmr::memory_resource *getMemoryResource(MemoryTag tag);
 }
 
 #define PP_NEW(Type, ...) \
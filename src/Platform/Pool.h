@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef PIXELPULSE_PLATFORM_POOL_H
+#define PIXELPULSE_PLATFORM_POOL_H
+
+#include "Platform/Std.h"
+#include "Platform/Memory.h"
+#include "Platform/Containers.h"
+#include "Logger.h"
+
+namespace PixelPulse::Platform
+{
+    // Fixed-size object pool. Slots are carved out of blocks allocated through MemoryAllocator
+    // under Tag, freed slots go on an intrusive free list and are reused before a new block is
+    // allocated. Objects never move, blocks are only returned when the pool is destroyed.
+    template <typename T, Memory::MemoryTag Tag = Memory::MemoryTag::General>
+    class ObjectPool
+    {
+    public:
+        explicit ObjectPool(std::size_t blockSize = 256) : m_freeList(nullptr),
+                                                           m_blockSize(std::max<std::size_t>(blockSize, 1)),
+                                                           m_freeCount(0),
+                                                           m_liveCount(0)
+        {
+        }
+
+        ~ObjectPool()
+        {
+            if (m_liveCount > 0)
+            {
+                Logger::warning("ObjectPool: Destroyed with %zu live objects", m_liveCount);
+            }
+
+            for (Slot *block : m_blocks)
+            {
+                Memory::MemoryAllocator::getInstance().deallocate(block);
+            }
+            m_blocks.clear();
+        }
+
+        ObjectPool(const ObjectPool &) = delete;
+        ObjectPool &operator=(const ObjectPool &) = delete;
+
+        template <typename... Args>
+        T *create(Args &&...args)
+        {
+            if (!m_freeList && !allocateBlock(m_blockSize))
+            {
+                return nullptr;
+            }
+
+            Slot *slot = m_freeList;
+            m_freeList = slot->next;
+            m_freeCount--;
+            m_liveCount++;
+
+            return new (slot->storage) T(std::forward<Args>(args)...);
+        }
+
+        void destroy(T *object)
+        {
+            if (!object)
+            {
+                return;
+            }
+
+            object->~T();
+
+            Slot *slot = reinterpret_cast<Slot *>(object);
+            slot->next = m_freeList;
+            m_freeList = slot;
+            m_freeCount++;
+            m_liveCount--;
+        }
+
+        // Makes sure the next count creations do not allocate, in one block
+        bool reserve(std::size_t count)
+        {
+            if (count <= m_freeCount)
+            {
+                return true;
+            }
+
+            return allocateBlock(std::max(count - m_freeCount, m_blockSize));
+        }
+
+        std::size_t getLiveCount() const { return m_liveCount; }
+        std::size_t getFreeCount() const { return m_freeCount; }
+
+    private:
+        union Slot
+        {
+            Slot *next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        bool allocateBlock(std::size_t count)
+        {
+            void *memory = Memory::MemoryAllocator::getInstance().allocateAligned(
+                sizeof(Slot) * count, alignof(Slot), __FILE__, __LINE__, __FUNCTION__, Tag);
+            if (!memory)
+            {
+                Logger::error("ObjectPool: Failed to allocate a block of %zu objects", count);
+                return false;
+            }
+
+            Slot *block = static_cast<Slot *>(memory);
+            m_blocks.push_back(block);
+
+            // Thread the new slots onto the free list in address order
+            for (std::size_t i = count; i > 0; --i)
+            {
+                block[i - 1].next = m_freeList;
+                m_freeList = &block[i - 1];
+            }
+            m_freeCount += count;
+            return true;
+        }
+
+        Slot *m_freeList;
+        std::size_t m_blockSize;
+        std::size_t m_freeCount;
+        std::size_t m_liveCount;
+        Vector<Slot *, Tag> m_blocks;
+    };
+}
+
+#endif
@@ -18,7 +18,15 @@
 #include <unordered_map>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 #include <algorithm>
+#include <limits>
+#include <new>
+#include <memory_resource>
+#include <span>
+#include <tuple>
 
 #include "Memory.h"
 
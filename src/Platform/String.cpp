@@ -18,7 +18,7 @@ namespace PixelPulse::Platform
         std::size_t len_b = std::strlen(b);
         std::size_t total_len = len_a + len_b + 1; // +1 for null terminator
 
-        char *result = (char *)std::malloc(total_len);
+        char *result = (char *)PP_MALLOC(total_len);
         if (!result)
         {
             return nullptr;
@@ -0,0 +1,203 @@
+#include "VirtualMemory.h"
+#include "Platform.h"
+
+#if !defined(PLATFORM_WINDOWS) && !defined(PLATFORM_WASM)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace PixelPulse::Platform::Memory
+{
+    // Pages are committed in chunks of at least this size to keep the number of system calls down
+    static constexpr std::size_t CommitGranularity = 64 * 1024;
+
+    static std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static void *platformReserve(std::size_t size)
+    {
+#if defined(PLATFORM_WINDOWS)
+        return ::VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#elif defined(PLATFORM_WASM)
+        void *ptr = nullptr;
+        if (::posix_memalign(&ptr, VirtualArena::getPageSize(), size) != 0)
+        {
+            return nullptr;
+        }
+        return ptr;
+#else
+        void *ptr = ::mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+    }
+
+    static void platformRelease(void *ptr, std::size_t size)
+    {
+#if defined(PLATFORM_WINDOWS)
+        PIXELPULSE_ARG_UNUSED(size);
+        ::VirtualFree(ptr, 0, MEM_RELEASE);
+#elif defined(PLATFORM_WASM)
+        PIXELPULSE_ARG_UNUSED(size);
+        ::free(ptr);
+#else
+        ::munmap(ptr, size);
+#endif
+    }
+
+    static bool platformCommit(void *ptr, std::size_t size)
+    {
+#if defined(PLATFORM_WINDOWS)
+        return ::VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#elif defined(PLATFORM_WASM)
+        PIXELPULSE_ARG_UNUSED(ptr);
+        PIXELPULSE_ARG_UNUSED(size);
+        return true;
+#else
+        return ::mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    static void platformDecommit(void *ptr, std::size_t size)
+    {
+#if defined(PLATFORM_WINDOWS)
+        ::VirtualFree(ptr, size, MEM_DECOMMIT);
+#elif defined(PLATFORM_WASM)
+        PIXELPULSE_ARG_UNUSED(ptr);
+        PIXELPULSE_ARG_UNUSED(size);
+#else
+        // Mapping fresh inaccessible pages over the range drops the backing memory on every POSIX system
+        ::mmap(ptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+#endif
+    }
+
+    std::size_t VirtualArena::getPageSize()
+    {
+#if defined(PLATFORM_WINDOWS)
+        static const std::size_t pageSize = []()
+        {
+            SYSTEM_INFO info;
+            ::GetSystemInfo(&info);
+            return static_cast<std::size_t>(info.dwPageSize);
+        }();
+        return pageSize;
+#elif defined(PLATFORM_WASM)
+        return 64 * 1024;
+#else
+        static const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return pageSize;
+#endif
+    }
+
+    VirtualArena::VirtualArena() : m_base(nullptr),
+                                   m_reserved(0),
+                                   m_committed(0),
+                                   m_used(0)
+    {
+    }
+
+    VirtualArena::~VirtualArena()
+    {
+        release();
+    }
+
+    bool VirtualArena::reserve(std::size_t reserveBytes)
+    {
+        if (m_base)
+        {
+            Logger::error("VirtualArena: Address range is already reserved");
+            return false;
+        }
+
+        if (reserveBytes == 0)
+        {
+            Logger::error("VirtualArena: Cannot reserve an empty address range");
+            return false;
+        }
+
+        std::size_t size = alignUp(reserveBytes, getPageSize());
+        void *base = platformReserve(size);
+        if (!base)
+        {
+            Logger::error("VirtualArena: Failed to reserve %zu bytes of address space", size);
+            return false;
+        }
+
+        m_base = static_cast<unsigned char *>(base);
+        m_reserved = size;
+        m_committed = 0;
+        m_used = 0;
+
+        MemoryAllocator::getInstance().addVirtualMemory(m_reserved, 0);
+        return true;
+    }
+
+    void VirtualArena::release()
+    {
+        if (!m_base)
+        {
+            return;
+        }
+
+        MemoryAllocator::getInstance().removeVirtualMemory(m_reserved, m_committed);
+        platformRelease(m_base, m_reserved);
+
+        m_base = nullptr;
+        m_reserved = 0;
+        m_committed = 0;
+        m_used = 0;
+    }
+
+    bool VirtualArena::commit(std::size_t bytes)
+    {
+        if (bytes <= m_committed)
+        {
+            return true;
+        }
+
+        if (!m_base || bytes > m_reserved)
+        {
+            Logger::error("VirtualArena: Cannot commit %zu bytes, only %zu bytes are reserved", bytes, m_reserved);
+            return false;
+        }
+
+        std::size_t target = std::min(alignUp(bytes, std::max(CommitGranularity, getPageSize())), m_reserved);
+        if (!platformCommit(m_base + m_committed, target - m_committed))
+        {
+            Logger::error("VirtualArena: Failed to commit %zu bytes", target - m_committed);
+            return false;
+        }
+
+        MemoryAllocator::getInstance().addVirtualMemory(0, target - m_committed);
+        m_committed = target;
+        return true;
+    }
+
+    void VirtualArena::decommit(std::size_t bytes)
+    {
+        std::size_t keep = alignUp(bytes, getPageSize());
+        if (!m_base || keep >= m_committed)
+        {
+            return;
+        }
+
+        platformDecommit(m_base + keep, m_committed - keep);
+
+        MemoryAllocator::getInstance().removeVirtualMemory(0, m_committed - keep);
+        m_committed = keep;
+        m_used = std::min(m_used, keep);
+    }
+
+    void *VirtualArena::push(std::size_t size, std::size_t alignment)
+    {
+        std::size_t offset = alignUp(m_used, alignment);
+        if (!commit(offset + size))
+        {
+            return nullptr;
+        }
+
+        m_used = offset + size;
+        return m_base + offset;
+    }
+}
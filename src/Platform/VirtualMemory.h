@@ -0,0 +1,173 @@
+#pragma once
+
+#ifndef PIXELPULSE_VIRTUAL_MEMORY_H
+#define PIXELPULSE_VIRTUAL_MEMORY_H
+
+#include "Platform/Std.h"
+#include "Platform/Memory.h"
+#include "Logger.h"
+
+namespace PixelPulse::Platform::Memory
+{
+    // Reserves a large address range up front and commits pages on demand, so the memory never
+    // moves and growing it never copies. On WASM there is no virtual memory, the whole range is
+    // allocated on reserve and committing is only bookkeeping, keep reservations modest there.
+    class VirtualArena
+    {
+    public:
+        VirtualArena();
+        ~VirtualArena();
+
+        VirtualArena(const VirtualArena &) = delete;
+        VirtualArena &operator=(const VirtualArena &) = delete;
+
+        bool reserve(std::size_t reserveBytes);
+        void release();
+
+        // Makes at least the first `bytes` bytes of the range readable and writable
+        bool commit(std::size_t bytes);
+
+        // Returns committed pages past `bytes` to the system, the reservation is kept
+        void decommit(std::size_t bytes);
+
+        // Bump allocation from the range, commits pages as needed
+        void *push(std::size_t size, std::size_t alignment = DefaultAlignment);
+        void reset() { m_used = 0; }
+
+        void *getBase() const { return m_base; }
+        bool isReserved() const { return m_base != nullptr; }
+        std::size_t getUsedBytes() const { return m_used; }
+        std::size_t getCommittedBytes() const { return m_committed; }
+        std::size_t getReservedBytes() const { return m_reserved; }
+
+        static std::size_t getPageSize();
+
+    private:
+        unsigned char *m_base;
+        std::size_t m_reserved;
+        std::size_t m_committed;
+        std::size_t m_used;
+    };
+
+    // Growable array on top of a VirtualArena, elements never move while the array grows
+    template <typename T>
+    class VirtualArray
+    {
+    public:
+        VirtualArray() : m_size(0) {}
+
+        explicit VirtualArray(std::size_t maxCount) : m_size(0)
+        {
+            reserve(maxCount);
+        }
+
+        ~VirtualArray()
+        {
+            clear();
+        }
+
+        VirtualArray(const VirtualArray &) = delete;
+        VirtualArray &operator=(const VirtualArray &) = delete;
+
+        bool reserve(std::size_t maxCount)
+        {
+            static_assert(alignof(T) <= 4096, "VirtualArray elements must not be aligned beyond a page");
+
+            if (m_arena.isReserved())
+            {
+                Logger::error("VirtualArray: Address range is already reserved");
+                return false;
+            }
+
+            if (maxCount > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                Logger::error("VirtualArray: %zu elements of %zu bytes overflow the address space", maxCount, sizeof(T));
+                return false;
+            }
+
+            return m_arena.reserve(maxCount * sizeof(T));
+        }
+
+        template <typename... Args>
+        T *emplaceBack(Args &&...args)
+        {
+            if (!m_arena.commit((m_size + 1) * sizeof(T)))
+            {
+                return nullptr;
+            }
+
+            T *slot = data() + m_size;
+            new (slot) T(std::forward<Args>(args)...);
+            m_size++;
+            return slot;
+        }
+
+        T *pushBack(const T &value) { return emplaceBack(value); }
+
+        void popBack()
+        {
+            if (m_size > 0)
+            {
+                m_size--;
+                data()[m_size].~T();
+            }
+        }
+
+        // Order-preserving removal, shifts the tail down by one
+        T *erase(T *position)
+        {
+            T *last = end() - 1;
+            for (T *it = position; it < last; ++it)
+            {
+                *it = std::move(*(it + 1));
+            }
+            popBack();
+            return position;
+        }
+
+        // O(1) removal, moves the last element into the freed slot
+        void swapRemove(std::size_t index)
+        {
+            if (index + 1 < m_size)
+            {
+                data()[index] = std::move(data()[m_size - 1]);
+            }
+            popBack();
+        }
+
+        void clear()
+        {
+            while (m_size > 0)
+            {
+                popBack();
+            }
+        }
+
+        // Returns committed pages beyond the current size to the system
+        void shrinkToFit() { m_arena.decommit(m_size * sizeof(T)); }
+
+        T *data() { return static_cast<T *>(m_arena.getBase()); }
+        const T *data() const { return static_cast<const T *>(m_arena.getBase()); }
+
+        T &operator[](std::size_t index) { return data()[index]; }
+        const T &operator[](std::size_t index) const { return data()[index]; }
+
+        T &back() { return data()[m_size - 1]; }
+        const T &back() const { return data()[m_size - 1]; }
+
+        T *begin() { return data(); }
+        T *end() { return data() + m_size; }
+        const T *begin() const { return data(); }
+        const T *end() const { return data() + m_size; }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        std::size_t capacity() const { return m_arena.getReservedBytes() / sizeof(T); }
+
+    private:
+        VirtualArena m_arena;
+        std::size_t m_size;
+    };
+}
+
+#endif
@@ -1,15 +1,18 @@
 #include "Platform/Platform.h"
 #include "Platform/Std.h"
 #include "Platform/Memory.h"
+#include "Platform/JobSystem.h"
 #include "Logger.h"
 #define PIXELPULSE_LIBRARIES_SHOULD_IMPLEMENT
 #include "Libraries/Libraries.h"
 
 #include "Assets/AssetRegistry.h"
+#include "Assets/Atlas.h"
 #include "Game/RenderPassDescriptor.h"
 #include "Math/Vector2.h"
 #include "Game/Input.h"
 #include "Game/Scene.h"
+#include "Game/TextureCache.h"
 #include "Game/SceneNode.h"
 #include "Game/Events/UpdateEventPayload.h"
 #include "Game/Events/AttachEventPayload.h"
@@ -17,6 +20,13 @@
 
 namespace PixelPulse
 {
+    // Command-line options
+    struct ApplicationOptions
+    {
+        bool headless = false;       // --headless: no window, draws into a software-rendered surface
+        std::uint64_t frameLimit = 0; // --frames N: quits after N frames and reports the frame cost, 0 runs until quit
+    };
+
     class Application
     {
     private:
@@ -24,9 +34,12 @@ namespace PixelPulse
         std::uint64_t m_currentTime;
         std::uint64_t m_previousTime;
         float m_deltaTime;
+        std::uint64_t m_frameCount;
 
         ::SDL_Window *m_window;
         ::SDL_Renderer *m_renderer;
+        ::SDL_Surface *m_headlessSurface; // Render target of the software renderer in headless mode
+        ApplicationOptions m_options;
         Assets::AssetRegistry *m_assetRegistry;
         Math::Vector2<std::int32_t> m_windowSize;
 
@@ -34,6 +47,10 @@ namespace PixelPulse
         Game::Input m_input;
         Physics::PhysicsWorld *m_physicsWorld;
 
+        // The simulation of the next frame, runs as a job while this thread renders the last one
+        Game::Events::UpdateEventPayload m_updateEventPayload;
+        Platform::JobCounter m_simulationCounter;
+
         static void handleEvents(Application *app)
         {
             SDL_Event event;
@@ -55,6 +72,14 @@ namespace PixelPulse
             }
         }
 
+        static void simulate(void *context, std::size_t, std::size_t)
+        {
+            Application *app = static_cast<Application *>(context);
+
+            app->m_physicsWorld->update(app->m_updateEventPayload.deltaTime);
+            app->m_scene->update(app->m_updateEventPayload);
+        }
+
 #ifdef PLATFORM_WASM
         static void updateCallback()
         {
@@ -72,10 +97,13 @@ namespace PixelPulse
                         m_currentTime(0),
                         m_previousTime(0),
                         m_deltaTime(0.0f),
+                        m_frameCount(0),
                         m_window(nullptr),
                         m_renderer(nullptr),
+                        m_headlessSurface(nullptr),
                         m_scene(nullptr),
-                        m_physicsWorld(nullptr)
+                        m_physicsWorld(nullptr),
+                        m_updateEventPayload{}
         {
 #ifdef PLATFORM_WASM
             instance = this;
@@ -87,15 +115,18 @@ namespace PixelPulse
             cleanup();
         }
 
-        bool initialize(const char *title, int width, int height)
+        bool initialize(const char *title, int width, int height, const ApplicationOptions &options)
         {
+            m_options = options;
+
 #ifdef PIXELPULSE_DEBUG
             Logger::setLevel(Logger::Level::Debug);
 #else
             Logger::setLevel(Logger::Level::Info);
 #endif
 
-            if (!SDL_Init(SDL_INIT_VIDEO))
+            // Headless runs need no display, the software renderer does not use the video subsystem
+            if (!SDL_Init(m_options.headless ? 0 : SDL_INIT_VIDEO))
             {
                 Logger::error("Failed to initialize SDL: %s", SDL_GetError());
                 return false;
@@ -103,27 +134,44 @@ namespace PixelPulse
 
             m_currentTime = m_previousTime = SDL_GetTicks();
 
-            if (!SDL_CreateWindowAndRenderer(title, width, height,
-                                             SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE, &m_window, &m_renderer))
+            if (m_options.headless)
             {
-                Logger::error("Failed to create window or renderer: %s", SDL_GetError());
-                cleanup();
-                return false;
+                if (!createHeadlessRenderer(width, height))
+                {
+                    cleanup();
+                    return false;
+                }
             }
+            else
+            {
+                if (!SDL_CreateWindowAndRenderer(title, width, height,
+                                                 SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE, &m_window, &m_renderer))
+                {
+                    Logger::error("Failed to create window or renderer: %s", SDL_GetError());
+                    cleanup();
+                    return false;
+                }
 
-            SDL_GetWindowSize(m_window, &m_windowSize.x, &m_windowSize.y);
-            Logger::info("Window size: %d, %d", m_windowSize.x, m_windowSize.y);
-            SDL_SetWindowMinimumSize(m_window, 640, 480);
+                SDL_GetWindowSize(m_window, &m_windowSize.x, &m_windowSize.y);
+                Logger::info("Window size: %d, %d", m_windowSize.x, m_windowSize.y);
+                SDL_SetWindowMinimumSize(m_window, 640, 480);
 
-            if (!m_window || !m_renderer)
-            {
-                Logger::error("Window or renderer is null");
-                cleanup();
-                return false;
+                if (!m_window || !m_renderer)
+                {
+                    Logger::error("Window or renderer is null");
+                    cleanup();
+                    return false;
+                }
             }
 
+            // Before the scene, which sizes its per-thread command buffers from the thread count
+            Platform::JobSystem::getInstance().initialize();
+
             m_assetRegistry = PP_NEW(Assets::AssetRegistry);
 
+            // Baked by pixel_pulse_atlas, without it every image decodes its own PNG
+            m_assetRegistry->make<Assets::Atlas>(Assets::AssetMakeRequest{"assets/atlas/atlas.json"})->load();
+
             // Initialize physics world
             m_physicsWorld = PP_NEW(Physics::PhysicsWorld);
 
@@ -142,6 +190,12 @@ namespace PixelPulse
             }
             m_scene->start();
 
+#ifdef PIXELPULSE_DEBUG
+            // Steady-state frames should not allocate, report anything that does once the scene has warmed up
+            Platform::Memory::MemoryAllocator::getInstance().setFrameAllocationPolicy(
+                Platform::Memory::FrameAllocationPolicy::Log, 60);
+#endif
+
             return true;
         }
 
@@ -157,15 +211,20 @@ namespace PixelPulse
             // Subsystem updates
             m_input.update(m_deltaTime);
 
-            // Update physics world
-            m_physicsWorld->update(m_deltaTime);
+            // Frame sync point, no simulation is running. Spawns may create textures, so they
+            // happen here on the render thread.
+            m_scene->setViewportSize(m_windowSize);
+            m_scene->applyPendingChanges();
 
-            Game::Events::UpdateEventPayload updateEventPayload;
-            updateEventPayload.deltaTime = m_deltaTime;
-            updateEventPayload.input = &m_input;
+            // Simulate frame N + 1 (physics, entities, render extraction into the back snapshot)
+            // on a worker while this thread draws frame N from the front snapshot. Without
+            // workers the job runs right here and the frame is sequential.
+            m_updateEventPayload = Game::Events::UpdateEventPayload{};
+            m_updateEventPayload.deltaTime = m_deltaTime;
+            m_updateEventPayload.input = &m_input;
 
-            // Update scene graph starting from the root
-            m_scene->update(updateEventPayload);
+            Platform::JobSystem &jobSystem = Platform::JobSystem::getInstance();
+            jobSystem.schedule(Platform::Job{&Application::simulate, this, 0, 1, &m_simulationCounter});
 
             // Render
             SDL_SetRenderDrawColor(m_renderer, 100, 149, 237, 255); // Cornflower blue background
@@ -173,11 +232,38 @@ namespace PixelPulse
 
             Game::RenderPassDescriptor renderPassDescriptor;
             renderPassDescriptor.windowSize = m_windowSize;
+            renderPassDescriptor.camera = &m_scene->getRenderCamera();
+            renderPassDescriptor.viewProjection = renderPassDescriptor.camera->getViewProjection(m_windowSize);
 
-            // Render scene graph
+            // Render the front snapshot, the simulation only writes the back one
             m_scene->render(renderPassDescriptor);
 
+#ifdef PIXELPULSE_DEBUG
+            // About every five seconds at 60 fps
+            if (m_frameCount % 300 == 0)
+            {
+                const Game::SpriteBatchStats &renderStats = m_scene->getRenderStats();
+                const Game::SceneCullStats &cullStats = m_scene->getCullStats();
+                Logger::debug("Render: %u sprites (%u culled), %u draw calls, %u vertices",
+                              renderStats.sprites, cullStats.culled, renderStats.drawCalls, renderStats.vertices);
+            }
+#endif
+            m_frameCount++;
+            if (m_options.frameLimit > 0 && m_frameCount >= m_options.frameLimit)
+            {
+                m_shouldQuit = true;
+            }
+
             SDL_RenderPresent(m_renderer);
+
+            // Helps with the simulation's jobs until it is done, then hands its snapshot over
+            jobSystem.wait(m_simulationCounter);
+            m_scene->swapRenderSnapshots();
+
+            // Textures and atlas regions released before this frame's sync point are no longer drawn
+            Game::TextureCache::getInstance().destroyRetired();
+
+            PP_MemorySystemMarkFrame();
         }
 
         void run()
@@ -188,13 +274,44 @@ namespace PixelPulse
 #ifdef PLATFORM_WASM
             emscripten_set_main_loop(updateCallback, 0, true);
 #else
+            std::uint64_t runStart = SDL_GetPerformanceCounter();
             while (!m_shouldQuit)
             {
                 update();
             }
+
+            if (m_frameCount > 0 && (m_options.headless || m_options.frameLimit > 0))
+            {
+                double seconds = static_cast<double>(SDL_GetPerformanceCounter() - runStart) / static_cast<double>(SDL_GetPerformanceFrequency());
+                Logger::info("Ran %llu frames in %.3f s, %.3f ms per frame",
+                             static_cast<unsigned long long>(m_frameCount), seconds, seconds * 1000.0 / static_cast<double>(m_frameCount));
+            }
 #endif
         }
 
+        // Draws into a memory surface through SDL's software renderer, so the whole frame
+        // (simulation, extraction, sorting, submission, rasterization) runs without a display or GPU
+        bool createHeadlessRenderer(int width, int height)
+        {
+            m_headlessSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+            if (!m_headlessSurface)
+            {
+                Logger::error("Failed to create headless surface: %s", SDL_GetError());
+                return false;
+            }
+
+            m_renderer = SDL_CreateSoftwareRenderer(m_headlessSurface);
+            if (!m_renderer)
+            {
+                Logger::error("Failed to create software renderer: %s", SDL_GetError());
+                return false;
+            }
+
+            m_windowSize = Math::Vector2<std::int32_t>(width, height);
+            Logger::info("Headless, rendering %dx%d into memory", width, height);
+            return true;
+        }
+
         void cleanup()
         {
             Logger::info("Cleaning up application...");
@@ -206,6 +323,11 @@ namespace PixelPulse
                 m_scene = nullptr;
             }
 
+            Platform::JobSystem::getInstance().shutdown();
+
+            // Sprites are gone with the scene, this only reports and frees leaked textures
+            Game::TextureCache::getInstance().clear();
+
             if (m_physicsWorld)
             {
                 Logger::info("Cleaning up physics world");
@@ -236,6 +358,12 @@ namespace PixelPulse
                 m_renderer = nullptr;
             }
 
+            if (m_headlessSurface)
+            {
+                SDL_DestroySurface(m_headlessSurface);
+                m_headlessSurface = nullptr;
+            }
+
             SDL_Quit();
         }
     };
@@ -247,13 +375,27 @@ PixelPulse::Application *PixelPulse::Application::instance = nullptr;
 
 int main(int argc, char *argv[])
 {
-    PIXELPULSE_ARG_UNUSED(argc);
-    PIXELPULSE_ARG_UNUSED(argv);
+    PixelPulse::ApplicationOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            options.frameLimit = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            PixelPulse::Logger::warning("Ignoring unknown argument: %s", argv[i]);
+        }
+    }
 
     PP_MemorySystemInitialize();
 
     PixelPulse::Application *app = PP_NEW(PixelPulse::Application);
-    if (!app->initialize("Game", 800, 600))
+    if (!app->initialize("Game", 800, 600, options))
     {
         return 1;
     }
@@ -261,6 +403,7 @@ int main(int argc, char *argv[])
     app->run();
     PP_DELETE(app);
 
+    PP_MemorySystemDumpStats();
     PP_MemorySystemShutdown();
 
     return 0;
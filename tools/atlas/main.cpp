@@ -0,0 +1,328 @@
+// pixel_pulse_atlas: bakes the PNGs under <resources>/assets into pre-decoded atlas pages.
+//
+//   pixel_pulse_atlas <resources dir> <output dir> [--page-size N] [--padding N]
+//
+// Writes atlas_<n>.page files (Assets::AtlasPageHeader followed by RGBA8 pixels) and an
+// atlas.json manifest mapping every image path, relative to the resources directory as the
+// game requests it (e.g. "assets/player.png"), to its page and sub-rectangle. Loaded at
+// runtime by Assets::Atlas.
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <stb_image.h>
+#include <stb_rect_pack.h>
+#include <json/json.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Must match Assets::Atlas
+    constexpr std::uint32_t PageMagic = 0x58545050; // "PPTX"
+    constexpr std::uint32_t PageVersion = 1;
+
+    struct SourceImage
+    {
+        std::string path; // Relative to the resources directory, forward slashes
+        int width = 0;
+        int height = 0;
+        unsigned char *pixels = nullptr;
+        int page = -1;
+        int x = 0;
+        int y = 0;
+    };
+
+    struct Options
+    {
+        std::filesystem::path resourcesDirectory;
+        std::filesystem::path outputDirectory;
+        int pageSize = 4096; // Matches TextureAtlas::MaxPageSize, the largest page the runtime asks for
+        int padding = 1;
+    };
+
+    void printUsage()
+    {
+        std::fprintf(stderr, "Usage: pixel_pulse_atlas <resources dir> <output dir> [--page-size N] [--padding N]\n");
+    }
+
+    bool parseArguments(int argc, char **argv, Options &options)
+    {
+        std::vector<const char *> positional;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--page-size") == 0 && i + 1 < argc)
+            {
+                options.pageSize = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(argv[i], "--padding") == 0 && i + 1 < argc)
+            {
+                options.padding = std::atoi(argv[++i]);
+            }
+            else
+            {
+                positional.push_back(argv[i]);
+            }
+        }
+
+        if (positional.size() != 2 || options.pageSize <= 0 || options.padding < 0)
+        {
+            return false;
+        }
+
+        options.resourcesDirectory = positional[0];
+        options.outputDirectory = positional[1];
+        return true;
+    }
+
+    bool collectImages(const Options &options, std::vector<SourceImage> &images)
+    {
+        std::filesystem::path assetsDirectory = options.resourcesDirectory / "assets";
+        if (!std::filesystem::is_directory(assetsDirectory))
+        {
+            std::fprintf(stderr, "Error: %s is not a directory\n", assetsDirectory.string().c_str());
+            return false;
+        }
+
+        std::filesystem::path outputDirectory = std::filesystem::weakly_canonical(options.outputDirectory);
+
+        for (const auto &file : std::filesystem::recursive_directory_iterator(assetsDirectory))
+        {
+            if (!file.is_regular_file() || file.path().extension() != ".png")
+            {
+                continue;
+            }
+
+            // Never bake a previous output back in
+            std::filesystem::path parent = std::filesystem::weakly_canonical(file.path().parent_path());
+            if (parent == outputDirectory)
+            {
+                continue;
+            }
+
+            SourceImage image;
+            image.path = std::filesystem::relative(file.path(), options.resourcesDirectory).generic_string();
+
+            int channels = 0;
+            image.pixels = stbi_load(file.path().string().c_str(), &image.width, &image.height, &channels, 4);
+            if (!image.pixels)
+            {
+                std::fprintf(stderr, "Error: Failed to load %s: %s\n", image.path.c_str(), stbi_failure_reason());
+                return false;
+            }
+
+            if (image.width + options.padding * 2 > options.pageSize || image.height + options.padding * 2 > options.pageSize)
+            {
+                std::fprintf(stderr, "Warning: %s (%dx%d) does not fit a page, it stays a standalone PNG\n",
+                             image.path.c_str(), image.width, image.height);
+                stbi_image_free(image.pixels);
+                continue;
+            }
+
+            images.push_back(image);
+        }
+
+        // Directory order is unspecified, sorting keeps the output stable between runs
+        std::sort(images.begin(), images.end(), [](const SourceImage &a, const SourceImage &b)
+                  { return a.path < b.path; });
+        return true;
+    }
+
+    // Fills pages one at a time with the skyline packer, every image goes to the first page it fits
+    int packImages(const Options &options, std::vector<SourceImage> &images)
+    {
+        std::vector<stbrp_node> nodes(static_cast<std::size_t>(options.pageSize));
+        std::vector<stbrp_rect> rects;
+        int pageCount = 0;
+
+        for (;;)
+        {
+            rects.clear();
+            for (std::size_t i = 0; i < images.size(); ++i)
+            {
+                if (images[i].page < 0)
+                {
+                    stbrp_rect rect{};
+                    rect.id = static_cast<int>(i);
+                    rect.w = images[i].width + options.padding * 2;
+                    rect.h = images[i].height + options.padding * 2;
+                    rects.push_back(rect);
+                }
+            }
+
+            if (rects.empty())
+            {
+                return pageCount;
+            }
+
+            stbrp_context context;
+            stbrp_init_target(&context, options.pageSize, options.pageSize, nodes.data(), static_cast<int>(nodes.size()));
+            stbrp_setup_heuristic(&context, STBRP_HEURISTIC_Skyline_BL_sortHeight);
+            stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()));
+
+            bool packedAny = false;
+            for (const stbrp_rect &rect : rects)
+            {
+                if (rect.was_packed)
+                {
+                    SourceImage &image = images[static_cast<std::size_t>(rect.id)];
+                    image.page = pageCount;
+                    image.x = rect.x + options.padding;
+                    image.y = rect.y + options.padding;
+                    packedAny = true;
+                }
+            }
+
+            if (!packedAny)
+            {
+                std::fprintf(stderr, "Error: Packing made no progress\n");
+                return -1;
+            }
+            pageCount++;
+        }
+    }
+
+    bool writePage(const Options &options, const std::vector<SourceImage> &images, int page, nlohmann::json &pageJson)
+    {
+        // Pages are trimmed to the packed area, the padding stays transparent
+        int width = 0;
+        int height = 0;
+        for (const SourceImage &image : images)
+        {
+            if (image.page == page)
+            {
+                width = std::max(width, image.x + image.width + options.padding);
+                height = std::max(height, image.y + image.height + options.padding);
+            }
+        }
+
+        std::vector<unsigned char> pixels(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4, 0);
+        std::size_t pitch = static_cast<std::size_t>(width) * 4;
+
+        for (const SourceImage &image : images)
+        {
+            if (image.page != page)
+            {
+                continue;
+            }
+
+            std::size_t rowSize = static_cast<std::size_t>(image.width) * 4;
+            for (int row = 0; row < image.height; ++row)
+            {
+                std::memcpy(&pixels[static_cast<std::size_t>(image.y + row) * pitch + static_cast<std::size_t>(image.x) * 4],
+                            &image.pixels[static_cast<std::size_t>(row) * rowSize], rowSize);
+            }
+        }
+
+        std::string fileName = "atlas_" + std::to_string(page) + ".page";
+        std::filesystem::path filePath = options.outputDirectory / fileName;
+
+        std::ofstream file(filePath, std::ios::binary);
+        if (!file.is_open())
+        {
+            std::fprintf(stderr, "Error: Failed to open %s for writing\n", filePath.string().c_str());
+            return false;
+        }
+
+        const std::uint32_t header[4] = {PageMagic, PageVersion, static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height)};
+        file.write(reinterpret_cast<const char *>(header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+        if (!file)
+        {
+            std::fprintf(stderr, "Error: Failed to write %s\n", filePath.string().c_str());
+            return false;
+        }
+
+        pageJson = {{"file", fileName}, {"width", width}, {"height", height}};
+        std::printf("Wrote %s (%dx%d)\n", filePath.string().c_str(), width, height);
+        return true;
+    }
+
+    bool writeAtlas(const Options &options, const std::vector<SourceImage> &images, int pageCount)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(options.outputDirectory, error);
+        if (error)
+        {
+            std::fprintf(stderr, "Error: Failed to create %s: %s\n", options.outputDirectory.string().c_str(), error.message().c_str());
+            return false;
+        }
+
+        // Pages of an earlier bake that had more of them would linger otherwise
+        for (const auto &file : std::filesystem::directory_iterator(options.outputDirectory))
+        {
+            const std::string fileName = file.path().filename().string();
+            if (file.is_regular_file() && fileName.rfind("atlas_", 0) == 0 && file.path().extension() == ".page")
+            {
+                std::filesystem::remove(file.path(), error);
+            }
+        }
+
+        nlohmann::json manifest;
+        manifest["version"] = PageVersion;
+        manifest["pages"] = nlohmann::json::array();
+        manifest["images"] = nlohmann::json::array();
+
+        for (int page = 0; page < pageCount; ++page)
+        {
+            nlohmann::json pageJson;
+            if (!writePage(options, images, page, pageJson))
+            {
+                return false;
+            }
+            manifest["pages"].push_back(pageJson);
+        }
+
+        for (const SourceImage &image : images)
+        {
+            manifest["images"].push_back({{"path", image.path},
+                                          {"page", image.page},
+                                          {"x", image.x},
+                                          {"y", image.y},
+                                          {"width", image.width},
+                                          {"height", image.height}});
+        }
+
+        std::filesystem::path manifestPath = options.outputDirectory / "atlas.json";
+        std::ofstream file(manifestPath);
+        if (!file.is_open())
+        {
+            std::fprintf(stderr, "Error: Failed to open %s for writing\n", manifestPath.string().c_str());
+            return false;
+        }
+
+        file << manifest.dump(4) << '\n';
+        std::printf("Wrote %s (%zu images on %d pages)\n", manifestPath.string().c_str(), images.size(), pageCount);
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseArguments(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<SourceImage> images;
+    bool succeeded = collectImages(options, images);
+
+    int pageCount = succeeded ? packImages(options, images) : -1;
+    succeeded = pageCount >= 0 && writeAtlas(options, images, pageCount);
+
+    for (SourceImage &image : images)
+    {
+        stbi_image_free(image.pixels);
+    }
+
+    return succeeded ? 0 : 1;
+}